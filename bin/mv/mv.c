@@ -263,8 +263,8 @@ fastcopy(char *from, char *to, struct stat *sbp)
 {
 	struct timespec ts[2];
 	static u_int32_t blen;
-	static char *bp;
-	int nread, from_fd, to_fd;
+	static char *bp, *zeroes;
+	int nread, wcount, from_fd, to_fd;
 	int badchown = 0, serrno = 0;
 
 	if (!blen) {
@@ -274,6 +274,13 @@ fastcopy(char *from, char *to, struct stat *sbp)
 			blen = 0;
 			return (1);
 		}
+		if ((zeroes = calloc(1, blen)) == NULL) {
+			warn(NULL);
+			free(bp);
+			bp = NULL;
+			blen = 0;
+			return (1);
+		}
 	}
 
 	if ((from_fd = open(from, O_RDONLY, 0)) == -1) {
@@ -292,13 +299,24 @@ fastcopy(char *from, char *to, struct stat *sbp)
 	}
 	(void) fchmod(to_fd, sbp->st_mode & ~(S_ISUID|S_ISGID));
 
-	while ((nread = read(from_fd, bp, blen)) > 0)
-		if (write(to_fd, bp, nread) != nread) {
+	while ((nread = read(from_fd, bp, blen)) > 0) {
+		/* Skip zero blocks so sparse files stay sparse. */
+		if (memcmp(bp, zeroes, nread) == 0)
+			wcount = lseek(to_fd, nread, SEEK_CUR) == -1 ?
+			    -1 : nread;
+		else
+			wcount = write(to_fd, bp, nread);
+		if (wcount != nread) {
 			warn("%s", to);
 			goto err;
 		}
+	}
 	if (nread == -1) {
 		warn("%s", from);
+		goto err;
+	}
+	if (ftruncate(to_fd, lseek(to_fd, 0, SEEK_CUR)) == -1) {
+		warn("%s", to);
 err:		if (unlink(to))
 			warn("%s: remove", to);
 		(void)close(from_fd);
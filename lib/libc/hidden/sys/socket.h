@@ -32,8 +32,10 @@ PROTO_NORMAL(getsockopt);
 PROTO_NORMAL(listen);
 PROTO_NORMAL(recv);
 PROTO_CANCEL(recvfrom);
+PROTO_CANCEL(recvmmsg);
 PROTO_CANCEL(recvmsg);
 PROTO_NORMAL(send);
+PROTO_CANCEL(sendmmsg);
 PROTO_CANCEL(sendmsg);
 PROTO_CANCEL(sendto);
 PROTO_NORMAL(setrtable);
@@ -180,6 +180,23 @@ b64_ntop(src, srclength, target, targsize)
 	return (datalength);
 }
 
+/* Value of ch in the Base64 alphabet, or -1 if it is not a member. */
+static int
+b64val(int ch)
+{
+	if (ch >= 'A' && ch <= 'Z')
+		return (ch - 'A');
+	if (ch >= 'a' && ch <= 'z')
+		return (ch - 'a' + 26);
+	if (ch >= '0' && ch <= '9')
+		return (ch - '0' + 52);
+	if (ch == '+')
+		return (62);
+	if (ch == '/')
+		return (63);
+	return (-1);
+}
+
 /* skips all whitespace anywhere.
    converts characters, four at a time, starting at (or after)
    src from base - 64 numbers into three 8 bit bytes in the target area.
@@ -192,9 +209,8 @@ b64_pton(src, target, targsize)
 	u_char *target;
 	size_t targsize;
 {
-	int tarindex, state, ch;
+	int tarindex, state, ch, val;
 	u_char nextbyte;
-	char *pos;
 
 	state = 0;
 	tarindex = 0;
@@ -206,8 +222,8 @@ b64_pton(src, target, targsize)
 		if (ch == Pad64)
 			break;
 
-		pos = strchr(Base64, ch);
-		if (pos == 0) 		/* A non-base64 character. */
+		val = b64val(ch);
+		if (val < 0) 		/* A non-base64 character. */
 			return (-1);
 
 		switch (state) {
@@ -215,7 +231,7 @@ b64_pton(src, target, targsize)
 			if (target) {
 				if (tarindex >= targsize)
 					return (-1);
-				target[tarindex] = (pos - Base64) << 2;
+				target[tarindex] = val << 2;
 			}
 			state = 1;
 			break;
@@ -223,8 +239,8 @@ b64_pton(src, target, targsize)
 			if (target) {
 				if (tarindex >= targsize)
 					return (-1);
-				target[tarindex]   |=  (pos - Base64) >> 4;
-				nextbyte = ((pos - Base64) & 0x0f) << 4;
+				target[tarindex]   |=  val >> 4;
+				nextbyte = (val & 0x0f) << 4;
 				if (tarindex + 1 < targsize)
 					target[tarindex+1] = nextbyte;
 				else if (nextbyte)
@@ -237,8 +253,8 @@ b64_pton(src, target, targsize)
 			if (target) {
 				if (tarindex >= targsize)
 					return (-1);
-				target[tarindex]   |=  (pos - Base64) >> 2;
-				nextbyte = ((pos - Base64) & 0x03) << 6;
+				target[tarindex]   |=  val >> 2;
+				nextbyte = (val & 0x03) << 6;
 				if (tarindex + 1 < targsize)
 					target[tarindex+1] = nextbyte;
 				else if (nextbyte)
@@ -251,7 +267,7 @@ b64_pton(src, target, targsize)
 			if (target) {
 				if (tarindex >= targsize)
 					return (-1);
-				target[tarindex] |= (pos - Base64);
+				target[tarindex] |= val;
 			}
 			tarindex++;
 			state = 0;
@@ -31,18 +31,42 @@
  * SUCH DAMAGE.
  */
 
+#include <limits.h>
 #include <string.h>
 
+#define	LOWBITS		((unsigned long)-1 / UCHAR_MAX)	  /* 0x0101...01 */
+#define	HIGHBITS	(LOWBITS * (UCHAR_MAX / 2 + 1))	  /* 0x8080...80 */
+
 void *
 memchr(const void *s, int c, size_t n)
 {
-	if (n != 0) {
-		const unsigned char *p = s;
+	const unsigned char *p = s;
+	const unsigned long *w;
+	unsigned char ch = c;
+	unsigned long mask, x;
+
+	/* Scan bytes until p is word aligned. */
+	for (; n != 0 && (unsigned long)p % sizeof(*w) != 0; p++, n--) {
+		if (*p == ch)
+			return ((void *)p);
+	}
+
+	/*
+	 * XORing a word with ch repeated in every byte turns bytes
+	 * equal to ch into zero bytes, which
+	 * (x - 0x01..01) & ~x & 0x80..80 detects exactly.
+	 */
+	mask = ch * LOWBITS;
+	for (w = (const unsigned long *)p; n >= sizeof(*w);
+	    w++, n -= sizeof(*w)) {
+		x = *w ^ mask;
+		if (((x - LOWBITS) & ~x & HIGHBITS) != 0)
+			break;
+	}
 
-		do {
-			if (*p++ == (unsigned char)c)
-				return ((void *)(p - 1));
-		} while (--n != 0);
+	for (p = (const unsigned char *)w; n != 0; p++, n--) {
+		if (*p == ch)
+			return ((void *)p);
 	}
 	return (NULL);
 }
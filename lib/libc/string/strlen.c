@@ -29,16 +29,41 @@
  * SUCH DAMAGE.
  */
 
+#include <limits.h>
 #include <string.h>
 
+#define	LOWBITS		((unsigned long)-1 / UCHAR_MAX)	  /* 0x0101...01 */
+#define	HIGHBITS	(LOWBITS * (UCHAR_MAX / 2 + 1))	  /* 0x8080...80 */
+
 size_t
 strlen(const char *str)
 {
 	const char *s;
+	const unsigned long *w;
+
+	/*
+	 * Scan bytes until s is word aligned.  Whole-word reads are safe
+	 * from then on: the terminator lives inside the word containing
+	 * it, so no read crosses the end of the string's mapping.
+	 */
+	for (s = str; (unsigned long)s % sizeof(*w) != 0; s++) {
+		if (*s == '\0')
+			return (s - str);
+	}
 
-	for (s = str; *s; ++s)
-		;
-	return (s - str);
+	/*
+	 * (x - 0x01..01) & ~x & 0x80..80 is non-zero exactly when a
+	 * byte of x is zero; find the word holding the terminator,
+	 * then the byte.
+	 */
+	for (w = (const unsigned long *)s; ; w++) {
+		if (((*w - LOWBITS) & ~*w & HIGHBITS) != 0) {
+			s = (const char *)w;
+			while (*s != '\0')
+				s++;
+			return (s - str);
+		}
+	}
 }
 
 DEF_STRONG(strlen);
@@ -192,6 +192,11 @@ static struct state *	gmtptr;
 
 static char		lcl_TZname[TZ_STRLEN_MAX + 1];
 static int		lcl_is_set;
+
+/* Last conversion done by localtime_r(), protected by the lcl mutex. */
+static time_t		lcl_cache_t;
+static struct tm	lcl_cache_tm;
+static int		lcl_cache_ok;
 static int		gmt_is_set;
 _THREAD_PRIVATE_MUTEX(lcl);
 _THREAD_PRIVATE_MUTEX(gmt);
@@ -1083,6 +1088,7 @@ tzsetwall_basic(void)
 	if (lcl_is_set < 0)
 		return;
 	lcl_is_set = -1;
+	lcl_cache_ok = 0;
 
 	if (lclptr == NULL) {
 		lclptr = calloc(1, sizeof *lclptr);
@@ -1127,6 +1133,7 @@ tzset_basic(void)
 	lcl_is_set = strlen(name) < sizeof lcl_TZname;
 	if (lcl_is_set)
 		strlcpy(lcl_TZname, name, sizeof lcl_TZname);
+	lcl_cache_ok = 0;
 
 	if (lclptr == NULL) {
 		lclptr = calloc(1, sizeof *lclptr);
@@ -1270,7 +1277,20 @@ localtime_r(const time_t *timep, struct tm *p_tm)
 {
 	_THREAD_PRIVATE_MUTEX_LOCK(lcl);
 	tzset_basic();
-	p_tm = localsub(timep, 0L, p_tm);
+	/*
+	** Log writers convert the same second over and over; reuse the
+	** previous result when the input repeats and the zone has not
+	** been reloaded since.
+	*/
+	if (lcl_cache_ok && *timep == lcl_cache_t) {
+		*p_tm = lcl_cache_tm;
+		tzname[p_tm->tm_isdst] = p_tm->tm_zone;
+	} else if (localsub(timep, 0L, p_tm) == p_tm) {
+		lcl_cache_t = *timep;
+		lcl_cache_tm = *p_tm;
+		lcl_cache_ok = 1;
+	} else
+		p_tm = NULL;
 	_THREAD_PRIVATE_MUTEX_UNLOCK(lcl);
 	return p_tm;
 }
@@ -338,9 +338,13 @@ evbuffer_expand(struct evbuffer *buf, size_t datlen)
 
 	/*
 	 * If the misalignment fulfills our data needs, we just force an
-	 * alignment to happen.  Afterwards, we have enough space.
+	 * alignment to happen.  Afterwards, we have enough space.  Only
+	 * do so when it reclaims at least half of the buffer; otherwise
+	 * a large buffer draining slowly would pay a memmove of all the
+	 * unread data for every small add.
 	 */
-	if (buf->totallen - buf->off >= datlen) {
+	if (buf->totallen - buf->off >= datlen &&
+	    buf->misalign >= buf->totallen / 2) {
 		evbuffer_align(buf);
 	} else {
 		void *newbuf;
@@ -349,6 +353,13 @@ evbuffer_expand(struct evbuffer *buf, size_t datlen)
 
 		if (length < 256)
 			length = 256;
+		/*
+		 * If we got here with enough capacity and only the
+		 * misalignment in the way, grow anyway so the aligns
+		 * stay rare.
+		 */
+		if (length >= need && length <= SIZE_MAX / 2)
+			length <<= 1;
 		if (need < SIZE_MAX / 2) {
 			while (length < need) {
 				length <<= 1;
@@ -507,7 +507,15 @@ void
 crypto_init(void)
 {
 	crypto_taskq = taskq_create("crypto", 1, IPL_VM, 0);
-	crypto_taskq_mpsafe = taskq_create("crynlk", 1, IPL_VM, TASKQ_MPSAFE);
+
+	/*
+	 * Requests for mpsafe drivers do not depend on the kernel
+	 * lock, so let them run on all cpus.  ESP with many SAs
+	 * queues enough independent requests to keep the threads
+	 * busy.
+	 */
+	crypto_taskq_mpsafe = taskq_create("crynlk", ncpusfound, IPL_VM,
+	    TASKQ_MPSAFE);
 
 	pool_init(&cryptop_pool, sizeof(struct cryptop), 0, IPL_VM, 0,
 	    "cryptop", NULL);
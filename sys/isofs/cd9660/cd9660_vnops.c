@@ -229,6 +229,11 @@ cd9660_read(void *v)
 	int error = 0;
 	long size, on;
 	size_t n;
+#define MAX_RA 32
+	struct ra {
+		daddr_t blks[MAX_RA];
+		int sizes[MAX_RA];
+	} *ra = NULL;
 
 	if (uio->uio_resid == 0)
 		return (0);
@@ -244,20 +249,16 @@ cd9660_read(void *v)
 		n = ulmin(imp->logical_block_size - on, uio->uio_resid);
 		diff = (off_t)ip->i_size - uio->uio_offset;
 		if (diff <= 0)
-			return (0);
+			break;
 		if (diff < n)
 			n = diff;
 		size = blksize(imp, ip, lbn);
 		rablock = lbn + 1;
-#define MAX_RA 32
 		if (ci->ci_lastr + 1 == lbn) {
-			struct ra {
-				daddr_t blks[MAX_RA];
-				int sizes[MAX_RA];
-			} *ra;
 			int i;
 
-			ra = malloc(sizeof *ra, M_TEMP, M_WAITOK);
+			if (ra == NULL)
+				ra = malloc(sizeof *ra, M_TEMP, M_WAITOK);
 			for (i = 0; i < MAX_RA &&
 			    lblktosize(imp, (rablock + i)) < ip->i_size;
 			    i++) {
@@ -266,20 +267,20 @@ cd9660_read(void *v)
 			}
 			error = breadn(vp, lbn, size, ra->blks,
 			    ra->sizes, i, &bp);
-			free(ra, M_TEMP, 0);
 		} else
 			error = bread(vp, lbn, size, &bp);
 		ci->ci_lastr = lbn;
 		n = ulmin(n, size - bp->b_resid);
 		if (error) {
 			brelse(bp);
-			return (error);
+			break;
 		}
 
 		error = uiomove(bp->b_data + on, n, uio);
 
 		brelse(bp);
 	} while (error == 0 && uio->uio_resid > 0 && n != 0);
+	free(ra, M_TEMP, sizeof *ra);
 	return (error);
 }
 
@@ -104,7 +104,7 @@ void	*elf_copyargs(struct exec_package *, struct ps_strings *, void *,
 	    void *);
 int	exec_elf_fixup(struct proc *, struct exec_package *);
 int	elf_os_pt_note(struct proc *, struct exec_package *, Elf_Ehdr *,
-	    char *, size_t, size_t);
+	    Elf_Phdr *, char *, size_t, size_t);
 
 extern char sigcode[], esigcode[], sigcoderet[];
 #ifdef SYSCALL_DEBUG
@@ -597,7 +597,7 @@ exec_elf_makecmds(struct proc *p, struct exec_package *epp)
 	 * via a PT_NOTE then also check for a PT_OPENBSD_WXNEEDED segment.
 	 */
 	if (eh->e_ident[EI_OSABI] != ELFOSABI_OPENBSD && (error =
-	    elf_os_pt_note(p, epp, epp->ep_hdr, "OpenBSD", 8, 4)) != 0) {
+	    elf_os_pt_note(p, epp, epp->ep_hdr, ph, "OpenBSD", 8, 4)) != 0) {
 		goto bad;
 	}
 
@@ -850,19 +850,12 @@ exec_elf_fixup(struct proc *p, struct exec_package *epp)
 
 int
 elf_os_pt_note(struct proc *p, struct exec_package *epp, Elf_Ehdr *eh,
-    char *os_name, size_t name_size, size_t desc_size)
+    Elf_Phdr *hph, char *os_name, size_t name_size, size_t desc_size)
 {
-	Elf_Phdr *hph, *ph;
+	Elf_Phdr *ph;
 	Elf_Note *np = NULL;
-	size_t phsize;
 	int error;
 
-	hph = mallocarray(eh->e_phnum, sizeof(Elf_Phdr), M_TEMP, M_WAITOK);
-	phsize = eh->e_phnum * sizeof(Elf_Phdr);
-	if ((error = elf_read_from(p, epp->ep_vp, eh->e_phoff,
-	    hph, phsize)) != 0)
-		goto out1;
-
 	for (ph = hph;  ph < &hph[eh->e_phnum]; ph++) {
 		if (ph->p_type == PT_OPENBSD_WXNEEDED) {
 			epp->ep_flags |= EXEC_WXNEEDED;
@@ -879,7 +872,7 @@ elf_os_pt_note(struct proc *p, struct exec_package *epp, Elf_Ehdr *eh,
 		np = malloc(ph->p_filesz, M_TEMP, M_WAITOK);
 		if ((error = elf_read_from(p, epp->ep_vp, ph->p_offset,
 		    np, ph->p_filesz)) != 0)
-			goto out2;
+			goto out;
 
 #if 0
 		if (np->type != ELF_NOTE_TYPE_OSVERSION) {
@@ -892,23 +885,21 @@ elf_os_pt_note(struct proc *p, struct exec_package *epp, Elf_Ehdr *eh,
 		/* Check the name and description sizes. */
 		if (np->namesz != name_size ||
 		    np->descsz != desc_size)
-			goto out3;
+			break;
 
 		if (memcmp((np + 1), os_name, name_size))
-			goto out3;
+			break;
 
 		/* XXX: We could check for the specific emulation here */
 		/* All checks succeeded. */
 		error = 0;
-		goto out2;
+		goto out;
 	}
 
-out3:
 	error = ENOEXEC;
-out2:
-	free(np, M_TEMP, ph->p_filesz);
-out1:
-	free(hph, M_TEMP, phsize);
+out:
+	if (np != NULL)
+		free(np, M_TEMP, ph->p_filesz);
 	return error;
 }
 
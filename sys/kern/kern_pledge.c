@@ -172,6 +172,7 @@ const uint64_t pledge_syscalls[SYS_MAXSYSCALL] = {
 	[SYS_pwrite] = PLEDGE_STDIO,
 	[SYS_pwritev] = PLEDGE_STDIO,
 	[SYS_recvmsg] = PLEDGE_STDIO,
+	[SYS_recvmmsg] = PLEDGE_STDIO,
 	[SYS_recvfrom] = PLEDGE_STDIO | PLEDGE_YPACTIVE,
 	[SYS_ftruncate] = PLEDGE_STDIO,
 	[SYS_lseek] = PLEDGE_STDIO,
@@ -188,6 +189,7 @@ const uint64_t pledge_syscalls[SYS_MAXSYSCALL] = {
 	 * "unix", "dns".  SCM_RIGHTS requires "sendfd" or "recvfd".
 	 */
 	[SYS_sendmsg] = PLEDGE_STDIO,
+	[SYS_sendmmsg] = PLEDGE_STDIO,
 
 	/* Common signal operations */
 	[SYS_nanosleep] = PLEDGE_STDIO,
@@ -33,8 +33,14 @@
  * process attempting to acquire the lock should be spinning. We start with
  * the most simple approach: we do RW_SPINS attempts at most before eventually
  * giving up and putting the process to sleep queue.
+ *
+ * The busy-wait between attempts grows exponentially up to
+ * RW_SPIN_DELAY_MAX cycles, so a crowd of spinners re-reads the lock
+ * word at a decreasing rate instead of keeping its cache line bouncing
+ * between CPUs for the whole spin period.
  */
 #define RW_SPINS	1000
+#define RW_SPIN_DELAY_MAX	32
 
 #ifdef MULTIPROCESSOR
 #define rw_cas(p, o, n)	(atomic_cas_ulong(p, o, n) != o)
@@ -230,6 +236,7 @@ rw_enter(struct rwlock *rwl, int flags)
 	 * can progress. Hence no spinning if we hold the kernel lock.
 	 */
 	unsigned int spin = (_kernel_lock_held()) ? 0 : RW_SPINS;
+	unsigned int spin_delay = 1;
 #endif
 	int error;
 #ifdef WITNESS
@@ -258,12 +265,18 @@ retry:
 
 #ifdef MULTIPROCESSOR
 		/*
-		 * It makes sense to try to spin just in case the lock
-		 * is acquired by writer.
+		 * It makes sense to try to spin while the lock is held,
+		 * whether by a writer or by readers: critical sections
+		 * are typically much shorter than a sleep/wakeup cycle.
 		 */
-		if ((o & RWLOCK_WRLOCK) && (spin != 0)) {
+		if (spin != 0) {
+			unsigned int i;
+
 			spin--;
-			CPU_BUSY_CYCLE();
+			for (i = spin_delay; i > 0; i--)
+				CPU_BUSY_CYCLE();
+			if (spin_delay < RW_SPIN_DELAY_MAX)
+				spin_delay <<= 1;
 			continue;
 		}
 #endif
@@ -493,6 +493,14 @@ sched_steal_proc(struct cpu_info *self)
 
 		spc = &ci->ci_schedstate;
 
+		/*
+		 * Only consider the first stealable proc on each cpu's
+		 * highest priority queue.  Walking every runnable proc
+		 * on every cpu makes the time spent here (and thus the
+		 * sched lock hold time) grow with the total number of
+		 * runnable procs, which is exactly when stealing needs
+		 * to be cheap.
+		 */
 		queue = ffs(spc->spc_whichqs) - 1;
 		TAILQ_FOREACH(p, &spc->spc_qs[queue], p_runq) {
 			if (p->p_flag & P_CPUPEG)
@@ -504,6 +512,7 @@ sched_steal_proc(struct cpu_info *self)
 				best = p;
 				bestcost = cost;
 			}
+			break;
 		}
 	}
 	if (best == NULL)
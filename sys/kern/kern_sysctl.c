@@ -2446,6 +2446,35 @@ sysctl_cpustats(int *name, u_int namelen, void *oldp, size_t *oldlenp,
 	if (namelen != 1)
 		return (ENOTDIR);
 
+	if (name[0] == KERN_CPUSTATS_ALL) {
+		struct cpustats *css;
+		size_t len;
+		u_int unit;
+		int error;
+
+		/*
+		 * Snapshot every CPU in a single call so that monitoring
+		 * tools do not have to issue one sysctl per CPU and the
+		 * per-CPU samples are taken close together in time.
+		 */
+		len = ncpusfound * sizeof(cs);
+		css = malloc(len, M_TEMP, M_WAITOK|M_ZERO);
+		CPU_INFO_FOREACH(cii, ci) {
+			unit = CPU_INFO_UNIT(ci);
+			if (unit >= ncpusfound)
+				continue;
+			memcpy(&css[unit].cs_time,
+			    &ci->ci_schedstate.spc_cp_time,
+			    sizeof(css[unit].cs_time));
+			css[unit].cs_flags = 0;
+			if (cpu_is_online(ci))
+				css[unit].cs_flags |= CPUSTATS_ONLINE;
+		}
+		error = sysctl_rdstruct(oldp, oldlenp, newp, css, len);
+		free(css, M_TEMP, len);
+		return (error);
+	}
+
 	CPU_INFO_FOREACH(cii, ci) {
 		if (name[0] == CPU_INFO_UNIT(ci)) {
 			found = 1;
@@ -266,7 +266,7 @@ task_set(struct task *t, void (*fn)(void *), void *arg)
 int
 task_add(struct taskq *tq, struct task *w)
 {
-	int rv = 0;
+	int rv = 0, dowake = 0;
 
 	if (ISSET(w->t_flags, TASK_ONQUEUE))
 		return (0);
@@ -276,10 +276,18 @@ task_add(struct taskq *tq, struct task *w)
 		rv = 1;
 		SET(w->t_flags, TASK_ONQUEUE);
 		TAILQ_INSERT_TAIL(&tq->tq_worklist, w, t_entry);
+		/*
+		 * Only issue a wakeup if a thread is actually waiting;
+		 * a busy thread will pick the work up on its next pass.
+		 * tq_waiting is raised under tq_mtx before sleeping, so
+		 * no wakeup can be lost, and skipping the call keeps
+		 * busy queues off the scheduler lock.
+		 */
+		dowake = (tq->tq_waiting > 0);
 	}
 	mtx_leave(&tq->tq_mtx);
 
-	if (rv)
+	if (dowake)
 		wakeup_one(tq);
 
 	return (rv);
@@ -308,6 +316,7 @@ int
 taskq_next_work(struct taskq *tq, struct task *work)
 {
 	struct task *next;
+	int dowake;
 
 	mtx_enter(&tq->tq_mtx);
 retry:
@@ -342,9 +351,11 @@ retry:
 	*work = *next; /* copy to caller to avoid races */
 
 	next = TAILQ_FIRST(&tq->tq_worklist);
+	dowake = (next != NULL && tq->tq_nthreads > 1 &&
+	    tq->tq_waiting > 0);
 	mtx_leave(&tq->tq_mtx);
 
-	if (next != NULL && tq->tq_nthreads > 1)
+	if (dowake)
 		wakeup_one(tq);
 
 	return (1);
@@ -438,6 +438,19 @@ timeout_hardclock_update(void)
 {
 	int ret;
 
+	/*
+	 * This runs once per tick on the primary cpu only, so if we
+	 * are not crossing a wheel boundary and both the current
+	 * bucket and the worklist are empty there is nothing to do.
+	 * The unlocked reads are safe: buckets are only filled under
+	 * timeout_mutex and a timeout_add() racing us will be picked
+	 * up on the next tick, just as it is with the mutex held.
+	 */
+	if (MASKWHEEL(0, ticks) != 0 &&
+	    CIRCQ_EMPTY(&timeout_wheel[MASKWHEEL(0, ticks)]) &&
+	    CIRCQ_EMPTY(&timeout_todo))
+		return (0);
+
 	mtx_enter(&timeout_mutex);
 
 	MOVEBUCKET(0, ticks);
@@ -88,9 +88,13 @@ struct filterops pipe_wfiltops =
 #define MINPIPESIZE (PIPE_SIZE/3)
 
 /*
- * Limit the number of "big" pipes
+ * Limit the amount of memory that may go to enlarged "big" pipes.
+ * A fixed count of 32 big pipes meant that one pipeline-heavy user
+ * could exhaust the quota and everybody else fell back to PIPE_SIZE
+ * transfers; limiting the total kva spent on pipe buffers instead
+ * lets bulk writers grow their buffers whenever memory permits.
  */
-#define LIMITBIGPIPES	32
+#define LIMITPIPEKVA	(16*1024*1024)
 unsigned int nbigpipe;
 static unsigned int amountpipekva;
 
@@ -457,18 +461,14 @@ pipe_write(struct file *fp, struct uio *uio, int fflags)
 	 */
 	if ((uio->uio_resid > PIPE_SIZE) &&
 	    (wpipe->pipe_buffer.size <= PIPE_SIZE) &&
-	    (wpipe->pipe_buffer.cnt == 0)) {
-	    	unsigned int npipe;
-
-		npipe = atomic_inc_int_nv(&nbigpipe);
-		if ((npipe <= LIMITBIGPIPES) &&
-		    (error = pipelock(wpipe)) == 0) {
-			if ((wpipe->pipe_buffer.cnt != 0) ||
-			    (pipe_buffer_realloc(wpipe, BIG_PIPE_SIZE) != 0))
-				atomic_dec_int(&nbigpipe);
+	    (wpipe->pipe_buffer.cnt == 0) &&
+	    (amountpipekva + (BIG_PIPE_SIZE - PIPE_SIZE) <= LIMITPIPEKVA)) {
+		if ((error = pipelock(wpipe)) == 0) {
+			if ((wpipe->pipe_buffer.cnt == 0) &&
+			    (pipe_buffer_realloc(wpipe, BIG_PIPE_SIZE) == 0))
+				atomic_inc_int(&nbigpipe);
 			pipeunlock(wpipe);
-		} else
-			atomic_dec_int(&nbigpipe);
+		}
 	}
 
 	/*
@@ -136,8 +136,8 @@ char *syscallnames[] = {
 	"#113 (unimplemented fktrace)",		/* 113 = unimplemented fktrace */
 	"unveil",			/* 114 = unveil */
 	"__realpath",			/* 115 = __realpath */
-	"#116 (obsolete t32_gettimeofday)",		/* 116 = obsolete t32_gettimeofday */
-	"#117 (obsolete t32_getrusage)",		/* 117 = obsolete t32_getrusage */
+	"recvmmsg",			/* 116 = recvmmsg */
+	"sendmmsg",			/* 117 = sendmmsg */
 	"getsockopt",			/* 118 = getsockopt */
 	"thrkill",			/* 119 = thrkill */
 	"readv",			/* 120 = readv */
@@ -1126,8 +1126,13 @@ sosplice(struct socket *so, int fd, off_t max, struct timeval *tv)
 	if (sosplice_taskq == NULL) {
 		rw_enter_write(&sosplice_lock);
 		if (sosplice_taskq == NULL) {
-			tq = taskq_create("sosplice", 1, IPL_SOFTNET,
-			    TASKQ_MPSAFE);
+			/*
+			 * One thread per cpu: every task locks its own
+			 * socket pair, so moves for independent splices
+			 * can run concurrently.
+			 */
+			tq = taskq_create("sosplice", ncpusfound,
+			    IPL_SOFTNET, TASKQ_MPSAFE);
 			/* Ensure the taskq is fully visible to other CPUs. */
 			membar_producer();
 			sosplice_taskq = tq;
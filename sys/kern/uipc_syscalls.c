@@ -46,6 +46,7 @@
 #include <sys/socket.h>
 #include <sys/socketvar.h>
 #include <sys/signalvar.h>
+#include <sys/time.h>
 #include <sys/pledge.h>
 #include <sys/unpcb.h>
 #include <sys/un.h>
@@ -571,6 +572,93 @@ done:
 	return (error);
 }
 
+int
+sys_sendmmsg(struct proc *p, void *v, register_t *retval)
+{
+	struct sys_sendmmsg_args /* {
+		syscallarg(int) s;
+		syscallarg(struct mmsghdr *) mmsg;
+		syscallarg(unsigned int) vlen;
+		syscallarg(int) flags;
+	} */ *uap = v;
+	struct mmsghdr mmsg, *mmsgp = SCARG(uap, mmsg);
+	struct msghdr *msg = &mmsg.msg_hdr;
+	struct iovec aiov[UIO_SMALLIOV], *uiov, *iov = aiov;
+	int error = 0, flags, s;
+	unsigned int vlen, dgrams;
+	register_t retsnd;
+
+	s = SCARG(uap, s);
+	flags = SCARG(uap, flags);
+
+	/* Arbitrarily cap the number of messages handled per call. */
+	vlen = SCARG(uap, vlen);
+	if (vlen > 1024)
+		vlen = 1024;
+
+	for (dgrams = 0; dgrams < vlen; dgrams++) {
+		error = copyin(&mmsgp[dgrams], &mmsg, sizeof(mmsg));
+		if (error)
+			break;
+
+		if (msg->msg_iovlen > IOV_MAX) {
+			error = EMSGSIZE;
+			break;
+		}
+		if (msg->msg_iovlen > UIO_SMALLIOV)
+			iov = mallocarray(msg->msg_iovlen,
+			    sizeof(struct iovec), M_IOV, M_WAITOK);
+		else
+			iov = aiov;
+		if (msg->msg_iovlen > 0) {
+			error = copyin(msg->msg_iov, iov,
+			    msg->msg_iovlen * sizeof(struct iovec));
+			if (error)
+				break;
+		}
+		uiov = msg->msg_iov;
+		msg->msg_iov = iov;
+		msg->msg_flags = 0;
+
+#ifdef KTRACE
+		if (KTRPOINT(p, KTR_STRUCT)) {
+			ktrmsghdr(p, msg);
+			if (msg->msg_iovlen)
+				ktriovec(p, iov, msg->msg_iovlen);
+		}
+#endif
+		error = sendit(p, s, msg, flags, &retsnd);
+		if (error)
+			break;
+
+		msg->msg_iov = uiov;
+		mmsg.msg_len = retsnd;
+
+		error = copyout(&mmsg, &mmsgp[dgrams], sizeof(mmsg));
+		if (error)
+			break;
+
+		if (iov != aiov) {
+			free(iov, M_IOV,
+			    msg->msg_iovlen * sizeof(struct iovec));
+			iov = aiov;
+		}
+	}
+
+	if (iov != aiov)
+		free(iov, M_IOV, msg->msg_iovlen * sizeof(struct iovec));
+
+	/*
+	 * If messages have been sent an error is only reported on the
+	 * next call, so the caller knows how much of the array was
+	 * consumed.
+	 */
+	if (dgrams > 0)
+		error = 0;
+	*retval = dgrams;
+	return (error);
+}
+
 int
 sendit(struct proc *p, int s, struct msghdr *mp, int flags, register_t *retsize)
 {
@@ -772,6 +860,121 @@ done:
 	return (error);
 }
 
+int
+sys_recvmmsg(struct proc *p, void *v, register_t *retval)
+{
+	struct sys_recvmmsg_args /* {
+		syscallarg(int) s;
+		syscallarg(struct mmsghdr *) mmsg;
+		syscallarg(unsigned int) vlen;
+		syscallarg(int) flags;
+		syscallarg(struct timespec *) timeout;
+	} */ *uap = v;
+	struct mmsghdr mmsg, *mmsgp = SCARG(uap, mmsg);
+	struct timespec ts, now;
+	struct msghdr *msg = &mmsg.msg_hdr;
+	struct iovec aiov[UIO_SMALLIOV], *uiov, *iov = aiov;
+	int error = 0, flags, s;
+	unsigned int vlen, dgrams;
+	register_t retrec;
+
+	if (SCARG(uap, timeout) != NULL) {
+		error = copyin(SCARG(uap, timeout), &ts, sizeof(ts));
+		if (error)
+			return (error);
+#ifdef KTRACE
+		if (KTRPOINT(p, KTR_STRUCT))
+			ktrreltimespec(p, &ts);
+#endif
+		if (!timespecisvalid(&ts))
+			return (EINVAL);
+		getnanouptime(&now);
+		timespecadd(&now, &ts, &ts);
+	}
+
+	s = SCARG(uap, s);
+	flags = SCARG(uap, flags);
+
+	/* Arbitrarily cap the number of messages handled per call. */
+	vlen = SCARG(uap, vlen);
+	if (vlen > 1024)
+		vlen = 1024;
+
+	for (dgrams = 0; dgrams < vlen; dgrams++) {
+		error = copyin(&mmsgp[dgrams], &mmsg, sizeof(mmsg));
+		if (error)
+			break;
+
+		if (msg->msg_iovlen > IOV_MAX) {
+			error = EMSGSIZE;
+			break;
+		}
+		if (msg->msg_iovlen > UIO_SMALLIOV)
+			iov = mallocarray(msg->msg_iovlen,
+			    sizeof(struct iovec), M_IOV, M_WAITOK);
+		else
+			iov = aiov;
+		if (msg->msg_iovlen > 0) {
+			error = copyin(msg->msg_iov, iov,
+			    msg->msg_iovlen * sizeof(struct iovec));
+			if (error)
+				break;
+		}
+		uiov = msg->msg_iov;
+		msg->msg_iov = iov;
+		msg->msg_flags = flags & ~MSG_WAITFORONE;
+
+		error = recvit(p, s, msg, NULL, &retrec);
+		if (error)
+			break;
+
+		msg->msg_iov = uiov;
+		mmsg.msg_len = retrec;
+
+#ifdef KTRACE
+		if (KTRPOINT(p, KTR_STRUCT)) {
+			ktrmsghdr(p, msg);
+			if (msg->msg_iovlen)
+				ktriovec(p, iov, msg->msg_iovlen);
+		}
+#endif
+		error = copyout(&mmsg, &mmsgp[dgrams], sizeof(mmsg));
+		if (error)
+			break;
+
+		if (iov != aiov) {
+			free(iov, M_IOV,
+			    msg->msg_iovlen * sizeof(struct iovec));
+			iov = aiov;
+		}
+
+		/* Only block waiting for the first message. */
+		if (flags & MSG_WAITFORONE)
+			flags |= MSG_DONTWAIT;
+
+		if (SCARG(uap, timeout) != NULL) {
+			getnanouptime(&now);
+			if (timespeccmp(&now, &ts, >=)) {
+				dgrams++;
+				break;
+			}
+		}
+	}
+
+	if (iov != aiov)
+		free(iov, M_IOV, msg->msg_iovlen * sizeof(struct iovec));
+
+	/*
+	 * If messages have been received an error is only reported on
+	 * the next call, as the datagrams already delivered would
+	 * otherwise be lost.
+	 */
+	if (dgrams > 0)
+		error = 0;
+	*retval = dgrams;
+	return (error);
+}
+
 int
 recvit(struct proc *p, int s, struct msghdr *mp, caddr_t namelenp,
     register_t *retsize)
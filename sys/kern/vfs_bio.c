@@ -580,10 +580,16 @@ bread_cluster(struct vnode *vp, daddr_t blkno, int size, struct buf **rbpp)
 	*rbpp = bio_doread(vp, blkno, size, 0);
 
 	/*
-	 * If the buffer is in the cache skip any I/O operation.
+	 * If the buffer is in the cache skip any I/O operation, unless
+	 * this is the last block of a previous read-ahead run; then
+	 * start reading the next run now, while the caller is still
+	 * consuming cached blocks, instead of stalling on it later.
 	 */
-	if (ISSET((*rbpp)->b_flags, B_CACHE))
-		goto out;
+	if (ISSET((*rbpp)->b_flags, B_CACHE)) {
+		if (!ISSET((*rbpp)->b_flags, B_RA))
+			goto out;
+		CLR((*rbpp)->b_flags, B_RA);
+	}
 
 	if (size != round_page(size))
 		goto out;
@@ -645,6 +651,9 @@ bread_cluster(struct vnode *vp, daddr_t blkno, int size, struct buf **rbpp)
 		xbpp[i]->b_poffs = bp->b_poffs + (i * size);
 	}
 
+	/* Mark the last block so the next run is started early. */
+	SET(xbpp[howmany - 1]->b_flags, B_RA);
+
 	KASSERT(bp->b_lblkno == blkno + 1);
 	KASSERT(bp->b_vp == vp);
 
@@ -35,6 +35,7 @@
 #include <sys/param.h>
 #include <sys/systm.h>
 #include <sys/time.h>
+#include <sys/kernel.h>
 #include <sys/mount.h>
 #include <sys/vnode.h>
 #include <sys/lock.h>
@@ -176,11 +177,15 @@ cache_lookup(struct vnode *dvp, struct vnode **vpp,
 			nchstats.ncs_neghits++;
 			/*
 			 * Move this slot to end of the negative LRU chain,
+			 * but at most once a second; hot entries would
+			 * otherwise spend every hit rewriting the list.
 			 */
-			if (TAILQ_NEXT(ncp, nc_neg) != NULL) {
+			if (TAILQ_NEXT(ncp, nc_neg) != NULL &&
+			    ticks - ncp->nc_time >= hz) {
 				TAILQ_REMOVE(&nclruneghead, ncp, nc_neg);
 				TAILQ_INSERT_TAIL(&nclruneghead, ncp,
 				    nc_neg);
+				ncp->nc_time = ticks;
 			}
 			return (ENOENT);
 		} else {
@@ -193,11 +198,14 @@ cache_lookup(struct vnode *dvp, struct vnode **vpp,
 	}
 
 	/*
-	 * Move this slot to end of the regular LRU chain.
+	 * Move this slot to end of the regular LRU chain, with the
+	 * same once a second dampening as above.
 	 */
-	if (TAILQ_NEXT(ncp, nc_lru) != NULL) {
+	if (TAILQ_NEXT(ncp, nc_lru) != NULL &&
+	    ticks - ncp->nc_time >= hz) {
 		TAILQ_REMOVE(&nclruhead, ncp, nc_lru);
 		TAILQ_INSERT_TAIL(&nclruhead, ncp, nc_lru);
+		ncp->nc_time = ticks;
 	}
 
 	vp = ncp->nc_vp;
@@ -370,6 +378,7 @@ cache_enter(struct vnode *dvp, struct vnode *vp, struct componentname *cnp)
 	/* fill in cache info */
 	ncp->nc_dvp = dvp;
 	ncp->nc_dvpid = dvp->v_id;
+	ncp->nc_time = ticks;
 	ncp->nc_nlen = cnp->cn_namelen;
 	memcpy(ncp->nc_name, cnp->cn_nameptr, ncp->nc_nlen);
 	if (RBT_EMPTY(namecache_rb_cache, &dvp->v_nc_tree)) {
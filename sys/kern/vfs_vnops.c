@@ -345,7 +345,14 @@ vn_read(struct file *fp, struct uio *uio, int fflags)
 
 	KERNEL_LOCK();
 
-	vn_lock(vp, LK_EXCLUSIVE | LK_RETRY);
+	/*
+	 * Reading a regular file does not modify it, so take the vnode
+	 * lock shared and let readers of the same file run in parallel.
+	 * Everything else (devices, fifos, directories for the EISDIR
+	 * check) keeps the exclusive lock.
+	 */
+	vn_lock(vp, ((vp->v_type == VREG) ? LK_SHARED : LK_EXCLUSIVE) |
+	    LK_RETRY);
 
 	if ((fflags & FO_POSITION) == 0)
 		offset = uio->uio_offset = fp->f_offset;
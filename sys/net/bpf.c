@@ -72,7 +72,7 @@
 #include <net/if_vlan_var.h>
 #endif
 
-#define BPF_BUFSIZE 32768
+#define BPF_BUFSIZE 131072
 
 #define PRINET  26			/* interruptible */
 
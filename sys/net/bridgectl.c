@@ -53,6 +53,7 @@
 
 int	bridge_rtfind(struct bridge_softc *, struct ifbaconf *);
 int	bridge_rtdaddr(struct bridge_softc *, struct ether_addr *);
+void	bridge_rtnode_free(void *);
 u_int32_t bridge_hash(struct bridge_softc *, struct ether_addr *);
 
 int	bridge_brlconf(struct bridge_iflist *, struct ifbrlconf *);
@@ -196,7 +197,7 @@ bridge_rtupdate(struct bridge_softc *sc, struct ether_addr *ea,
 
 	h = bridge_hash(sc, ea);
 	mtx_enter(&sc->sc_mtx);
-	p = LIST_FIRST(&sc->sc_rts[h]);
+	p = SMR_LIST_FIRST_LOCKED(&sc->sc_rts[h]);
 	if (p == NULL) {
 		if (sc->sc_brtcnt >= sc->sc_brtmax)
 			goto done;
@@ -205,6 +206,7 @@ bridge_rtupdate(struct bridge_softc *sc, struct ether_addr *ea,
 			goto done;
 
 		bcopy(ea, &p->brt_addr, sizeof(p->brt_addr));
+		smr_init(&p->brt_smr);
 		p->brt_ifidx = ifp->if_index;
 		p->brt_age = 1;
 		bridge_copytag(brtag, &p->brt_tunnel);
@@ -214,14 +216,14 @@ bridge_rtupdate(struct bridge_softc *sc, struct ether_addr *ea,
 		else
 			p->brt_flags = IFBAF_DYNAMIC;
 
-		LIST_INSERT_HEAD(&sc->sc_rts[h], p, brt_next);
+		SMR_LIST_INSERT_HEAD_LOCKED(&sc->sc_rts[h], p, brt_next);
 		sc->sc_brtcnt++;
 		goto want;
 	}
 
 	do {
 		q = p;
-		p = LIST_NEXT(p, brt_next);
+		p = SMR_LIST_NEXT_LOCKED(p, brt_next);
 
 		dir = memcmp(ea, &q->brt_addr, sizeof(q->brt_addr));
 		if (dir == 0) {
@@ -245,6 +247,7 @@ bridge_rtupdate(struct bridge_softc *sc, struct ether_addr *ea,
 				goto done;
 
 			bcopy(ea, &p->brt_addr, sizeof(p->brt_addr));
+			smr_init(&p->brt_smr);
 			p->brt_ifidx = ifp->if_index;
 			p->brt_age = 1;
 			bridge_copytag(brtag, &p->brt_tunnel);
@@ -254,7 +257,7 @@ bridge_rtupdate(struct bridge_softc *sc, struct ether_addr *ea,
 			else
 				p->brt_flags = IFBAF_DYNAMIC;
 
-			LIST_INSERT_BEFORE(q, p, brt_next);
+			SMR_LIST_INSERT_BEFORE_LOCKED(q, p, brt_next);
 			sc->sc_brtcnt++;
 			goto want;
 		}
@@ -267,6 +270,7 @@ bridge_rtupdate(struct bridge_softc *sc, struct ether_addr *ea,
 				goto done;
 
 			bcopy(ea, &p->brt_addr, sizeof(p->brt_addr));
+			smr_init(&p->brt_smr);
 			p->brt_ifidx = ifp->if_index;
 			p->brt_age = 1;
 			bridge_copytag(brtag, &p->brt_tunnel);
@@ -275,7 +279,7 @@ bridge_rtupdate(struct bridge_softc *sc, struct ether_addr *ea,
 				p->brt_flags = flags;
 			else
 				p->brt_flags = IFBAF_DYNAMIC;
-			LIST_INSERT_AFTER(q, p, brt_next);
+			SMR_LIST_INSERT_AFTER_LOCKED(q, p, brt_next);
 			sc->sc_brtcnt++;
 			goto want;
 		}
@@ -298,8 +302,8 @@ bridge_rtlookup(struct ifnet *brifp, struct ether_addr *ea, struct mbuf *m)
 	int dir;
 
 	h = bridge_hash(sc, ea);
-	mtx_enter(&sc->sc_mtx);
-	LIST_FOREACH(p, &sc->sc_rts[h], brt_next) {
+	smr_read_enter();
+	SMR_LIST_FOREACH(p, &sc->sc_rts[h], brt_next) {
 		dir = memcmp(ea, &p->brt_addr, sizeof(p->brt_addr));
 		if (dir == 0)
 			break;
@@ -315,15 +319,31 @@ bridge_rtlookup(struct ifnet *brifp, struct ether_addr *ea, struct mbuf *m)
 			struct bridge_tunneltag *brtag;
 
 			brtag = bridge_tunneltag(m);
-			if (brtag != NULL)
+			if (brtag != NULL) {
+				/*
+				 * Tunnel endpoints are updated in place
+				 * under the mutex, so serialise the copy
+				 * against bridge_rtupdate().
+				 */
+				mtx_enter(&sc->sc_mtx);
 				bridge_copytag(&p->brt_tunnel, brtag);
+				mtx_leave(&sc->sc_mtx);
+			}
 		}
 	}
-	mtx_leave(&sc->sc_mtx);
+	smr_read_leave();
 
 	return (ifidx);
 }
 
+void
+bridge_rtnode_free(void *arg)
+{
+	struct bridge_rtnode *p = arg;
+
+	free(p, M_DEVBUF, sizeof(*p));
+}
+
 u_int32_t
 bridge_hash(struct bridge_softc *sc, struct ether_addr *addr)
 {
@@ -347,21 +367,21 @@ bridge_rtage(void *vsc)
 
 	mtx_enter(&sc->sc_mtx);
 	for (i = 0; i < BRIDGE_RTABLE_SIZE; i++) {
-		n = LIST_FIRST(&sc->sc_rts[i]);
+		n = SMR_LIST_FIRST_LOCKED(&sc->sc_rts[i]);
 		while (n != NULL) {
 			if ((n->brt_flags & IFBAF_TYPEMASK) == IFBAF_STATIC) {
 				n->brt_age = !n->brt_age;
 				if (n->brt_age)
 					n->brt_age = 0;
-				n = LIST_NEXT(n, brt_next);
+				n = SMR_LIST_NEXT_LOCKED(n, brt_next);
 			} else if (n->brt_age) {
 				n->brt_age = 0;
-				n = LIST_NEXT(n, brt_next);
+				n = SMR_LIST_NEXT_LOCKED(n, brt_next);
 			} else {
-				p = LIST_NEXT(n, brt_next);
-				LIST_REMOVE(n, brt_next);
+				p = SMR_LIST_NEXT_LOCKED(n, brt_next);
+				SMR_LIST_REMOVE_LOCKED(n, brt_next);
 				sc->sc_brtcnt--;
-				free(n, M_DEVBUF, sizeof *n);
+				smr_call(&n->brt_smr, bridge_rtnode_free, n);
 				n = p;
 			}
 		}
@@ -394,7 +414,7 @@ bridge_rtagenode(struct ifnet *ifp, int age)
 	else {
 		mtx_enter(&sc->sc_mtx);
 		for (i = 0; i < BRIDGE_RTABLE_SIZE; i++) {
-			LIST_FOREACH(n, &sc->sc_rts[i], brt_next) {
+			SMR_LIST_FOREACH_LOCKED(n, &sc->sc_rts[i], brt_next) {
 				/* Cap the expiry time to 'age' */
 				if (n->brt_ifidx == ifp->if_index &&
 				    n->brt_age > time_uptime + age &&
@@ -419,17 +439,17 @@ bridge_rtflush(struct bridge_softc *sc, int full)
 
 	mtx_enter(&sc->sc_mtx);
 	for (i = 0; i < BRIDGE_RTABLE_SIZE; i++) {
-		n = LIST_FIRST(&sc->sc_rts[i]);
+		n = SMR_LIST_FIRST_LOCKED(&sc->sc_rts[i]);
 		while (n != NULL) {
 			if (full ||
 			    (n->brt_flags & IFBAF_TYPEMASK) == IFBAF_DYNAMIC) {
-				p = LIST_NEXT(n, brt_next);
-				LIST_REMOVE(n, brt_next);
+				p = SMR_LIST_NEXT_LOCKED(n, brt_next);
+				SMR_LIST_REMOVE_LOCKED(n, brt_next);
 				sc->sc_brtcnt--;
-				free(n, M_DEVBUF, sizeof *n);
+				smr_call(&n->brt_smr, bridge_rtnode_free, n);
 				n = p;
 			} else
-				n = LIST_NEXT(n, brt_next);
+				n = SMR_LIST_NEXT_LOCKED(n, brt_next);
 		}
 	}
 	mtx_leave(&sc->sc_mtx);
@@ -446,12 +466,12 @@ bridge_rtdaddr(struct bridge_softc *sc, struct ether_addr *ea)
 
 	h = bridge_hash(sc, ea);
 	mtx_enter(&sc->sc_mtx);
-	LIST_FOREACH(p, &sc->sc_rts[h], brt_next) {
+	SMR_LIST_FOREACH_LOCKED(p, &sc->sc_rts[h], brt_next) {
 		if (memcmp(ea, &p->brt_addr, sizeof(p->brt_addr)) == 0) {
-			LIST_REMOVE(p, brt_next);
+			SMR_LIST_REMOVE_LOCKED(p, brt_next);
 			sc->sc_brtcnt--;
 			mtx_leave(&sc->sc_mtx);
-			free(p, M_DEVBUF, sizeof *p);
+			smr_call(&p->brt_smr, bridge_rtnode_free, p);
 			return (0);
 		}
 	}
@@ -475,23 +495,23 @@ bridge_rtdelete(struct bridge_softc *sc, struct ifnet *ifp, int dynonly)
 	 */
 	mtx_enter(&sc->sc_mtx);
 	for (i = 0; i < BRIDGE_RTABLE_SIZE; i++) {
-		n = LIST_FIRST(&sc->sc_rts[i]);
+		n = SMR_LIST_FIRST_LOCKED(&sc->sc_rts[i]);
 		while (n != NULL) {
 			if (n->brt_ifidx != ifp->if_index) {
 				/* Not ours */
-				n = LIST_NEXT(n, brt_next);
+				n = SMR_LIST_NEXT_LOCKED(n, brt_next);
 				continue;
 			}
 			if (dynonly &&
 			    (n->brt_flags & IFBAF_TYPEMASK) != IFBAF_DYNAMIC) {
 				/* only deleting dynamics */
-				n = LIST_NEXT(n, brt_next);
+				n = SMR_LIST_NEXT_LOCKED(n, brt_next);
 				continue;
 			}
-			p = LIST_NEXT(n, brt_next);
-			LIST_REMOVE(n, brt_next);
+			p = SMR_LIST_NEXT_LOCKED(n, brt_next);
+			SMR_LIST_REMOVE_LOCKED(n, brt_next);
 			sc->sc_brtcnt--;
-			free(n, M_DEVBUF, sizeof *n);
+			smr_call(&n->brt_smr, bridge_rtnode_free, n);
 			n = p;
 		}
 	}
@@ -511,7 +531,7 @@ bridge_rtfind(struct bridge_softc *sc, struct ifbaconf *baconf)
 
 	mtx_enter(&sc->sc_mtx);
 	for (k = 0; k < BRIDGE_RTABLE_SIZE; k++) {
-		LIST_FOREACH(n, &sc->sc_rts[k], brt_next)
+		SMR_LIST_FOREACH_LOCKED(n, &sc->sc_rts[k], brt_next)
 			total++;
 	}
 	mtx_leave(&sc->sc_mtx);
@@ -528,7 +548,7 @@ bridge_rtfind(struct bridge_softc *sc, struct ifbaconf *baconf)
 
 	mtx_enter(&sc->sc_mtx);
 	for (k = 0; k < BRIDGE_RTABLE_SIZE; k++) {
-		LIST_FOREACH(n, &sc->sc_rts[k], brt_next) {
+		SMR_LIST_FOREACH_LOCKED(n, &sc->sc_rts[k], brt_next) {
 			struct ifnet *ifp;
 
 			if (i >= total) {
@@ -235,7 +235,7 @@ int	ifq_congestion;
 
 int		 netisr;
 
-#define	NET_TASKQ	1
+#define	NET_TASKQ	4
 struct taskq	*nettqmp[NET_TASKQ];
 
 struct task if_input_task_locked = TASK_INITIALIZER(if_netisr, NULL);
@@ -3098,8 +3098,16 @@ if_rxr_adjust_cwm(struct if_rxring *rxr)
 			return;
 	} else if (rxr->rxr_alive >= rxr->rxr_lwm)
 		return;
-	else if (rxr->rxr_cwm < rxr->rxr_hwm)
-		rxr->rxr_cwm++;
+	else if (rxr->rxr_cwm < rxr->rxr_hwm) {
+		/*
+		 * Grow proportionally so deep rings recover from a
+		 * livelock backoff in a few adjustments rather than
+		 * one cluster per tick.
+		 */
+		rxr->rxr_cwm += MAX(1, rxr->rxr_cwm >> 3);
+		if (rxr->rxr_cwm > rxr->rxr_hwm)
+			rxr->rxr_cwm = rxr->rxr_hwm;
+	}
 
 	rxr->rxr_adjusted = ticks;
 }
@@ -176,7 +176,7 @@ bridge_clone_create(struct if_clone *ifc, int unit)
 	SMR_SLIST_INIT(&sc->sc_spanlist);
 	mtx_init(&sc->sc_mtx, IPL_MPFLOOR);
 	for (i = 0; i < BRIDGE_RTABLE_SIZE; i++)
-		LIST_INIT(&sc->sc_rts[i]);
+		SMR_LIST_INIT(&sc->sc_rts[i]);
 	arc4random_buf(&sc->sc_hashkey, sizeof(sc->sc_hashkey));
 	ifp = &sc->sc_if;
 	snprintf(ifp->if_xname, sizeof ifp->if_xname, "%s%d", ifc->ifc_name,
@@ -450,10 +450,12 @@ struct bridge_tunneltag {
 };
 
 /*
- * Bridge route node
+ * Bridge route node, inserted under the softc mutex, looked up
+ * within smr critical sections and reclaimed through smr_call().
  */
 struct bridge_rtnode {
-	LIST_ENTRY(bridge_rtnode)	brt_next;	/* next in list */
+	SMR_LIST_ENTRY(bridge_rtnode)	brt_next;	/* next in list */
+	struct smr_entry		brt_smr;	/* delayed free */
 	unsigned int			brt_ifidx;	/* destination ifs */
 	u_int8_t			brt_flags;	/* address flags */
 	u_int8_t			brt_age;	/* age counter */
@@ -474,6 +476,7 @@ struct bridge_rtnode {
  *	I	immutable after creation
  *	m	per-softc mutex
  *	k	kernel lock
+ *	s	smr read side
  */
 struct bridge_softc {
 	struct ifnet			sc_if;	/* the interface */
@@ -486,7 +489,7 @@ struct bridge_softc {
 	SMR_SLIST_HEAD(, bridge_iflist)	sc_iflist;	/* [k] interface list */
 	SMR_SLIST_HEAD(, bridge_iflist)	sc_spanlist;	/* [k] span ports */
 	struct mutex			sc_mtx;		/* mutex */
-	LIST_HEAD(, bridge_rtnode)	sc_rts[BRIDGE_RTABLE_SIZE];	/* [m] hash table */
+	SMR_LIST_HEAD(, bridge_rtnode)	sc_rts[BRIDGE_RTABLE_SIZE];	/* [m,s] hash table */
 };
 
 extern const u_int8_t bstp_etheraddr[];
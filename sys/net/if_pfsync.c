@@ -97,6 +97,14 @@
 	sizeof(struct ip) + \
 	sizeof(struct pfsync_header))
 
+/*
+ * Updates to young states want to go out quickly, but under a state
+ * insertion flood that would ship a stream of partial packets.  Allow
+ * this many early flushes per second, then fall back to coalescing
+ * until a full packet accumulates or the queue timeout fires.
+ */
+#define PFSYNC_MAX_FLUSHES	16
+
 int	pfsync_upd_tcp(struct pf_state *, struct pfsync_state_peer *,
 	    struct pfsync_state_peer *);
 
@@ -224,6 +232,9 @@ struct pfsync_softc {
 	void			*sc_plus;
 	size_t			 sc_pluslen;
 
+	time_t			 sc_flush_sec;
+	int			 sc_flushes;
+
 	u_int32_t		 sc_ureq_sent;
 	int			 sc_bulk_tries;
 	struct timeout		 sc_bulkfail_tmo;
@@ -1954,7 +1965,17 @@ pfsync_update_state_locked(struct pf_state *st)
 		    st->sync_state);
 	}
 
-	if (sync || (time_uptime - st->pfsync_time) < 2)
+	if (!sync && (time_uptime - st->pfsync_time) < 2) {
+		if (sc->sc_flush_sec != time_uptime) {
+			sc->sc_flush_sec = time_uptime;
+			sc->sc_flushes = 0;
+		}
+		if (sc->sc_flushes < PFSYNC_MAX_FLUSHES) {
+			sc->sc_flushes++;
+			sync = 1;
+		}
+	}
+	if (sync)
 		schednetisr(NETISR_PFSYNC);
 }
 
@@ -658,20 +658,26 @@ pf_state_compare_key(struct pf_state_key *a, struct pf_state_key *b)
 {
 	int	diff;
 
+	/*
+	 * Compare the cheap fields with the most entropy first; on a
+	 * busy firewall most states agree on proto and af and often on
+	 * one of the addresses, so deciding on the ports early keeps
+	 * the tree descent out of pf_addr_compare().
+	 */
 	if ((diff = a->proto - b->proto) != 0)
 		return (diff);
 	if ((diff = a->af - b->af) != 0)
 		return (diff);
-	if ((diff = pf_addr_compare(&a->addr[0], &b->addr[0], a->af)) != 0)
-		return (diff);
-	if ((diff = pf_addr_compare(&a->addr[1], &b->addr[1], a->af)) != 0)
-		return (diff);
 	if ((diff = a->port[0] - b->port[0]) != 0)
 		return (diff);
 	if ((diff = a->port[1] - b->port[1]) != 0)
 		return (diff);
 	if ((diff = a->rdomain - b->rdomain) != 0)
 		return (diff);
+	if ((diff = pf_addr_compare(&a->addr[0], &b->addr[0], a->af)) != 0)
+		return (diff);
+	if ((diff = pf_addr_compare(&a->addr[1], &b->addr[1], a->af)) != 0)
+		return (diff);
 	return (0);
 }
 
@@ -3541,8 +3547,10 @@ pf_match_rule(struct pf_test_ctx *ctx, struct pf_ruleset *ruleset)
 	r = TAILQ_FIRST(ruleset->rules.active.ptr);
 	while (r != NULL) {
 		r->evaluations++;
+		/* rules without "on" match any interface, skip the call */
 		PF_TEST_ATTRIB(
-		    (pfi_kif_match(r->kif, ctx->pd->kif) == r->ifnot),
+		    (r->kif == NULL ? r->ifnot == 1 :
+		    pfi_kif_match(r->kif, ctx->pd->kif) == r->ifnot),
 			r->skip[PF_SKIP_IFP].ptr);
 		PF_TEST_ATTRIB((r->direction && r->direction != ctx->pd->dir),
 			r->skip[PF_SKIP_DIR].ptr);
@@ -152,6 +152,12 @@ int			ifatrash;	/* ifas not in ifp list but not free */
 struct pool		rtentry_pool;	/* pool for rtentry structures */
 struct pool		rttimer_pool;	/* pool for rttimer structures */
 
+/*
+ * Generation number of the routing tables, bumped on every change.
+ * Consumers may use it to revalidate cached lookup results.
+ */
+u_long			rt_generation;
+
 void	rt_timer_init(void);
 int	rt_setgwroute(struct rtentry *, u_int);
 void	rt_putgwroute(struct rtentry *);
@@ -792,6 +798,7 @@ rtrequest_delete(struct rt_addrinfo *info, u_int8_t prio, struct ifnet *ifp,
 		rtfree(rt);
 		return (ESRCH);
 	}
+	atomic_inc_long(&rt_generation);
 
 	/* Release next hop cache before flushing cloned entries. */
 	rt_putgwroute(rt);
@@ -968,6 +975,7 @@ rtrequest(int req, struct rt_addrinfo *info, u_int8_t prio,
 			pool_put(&rtentry_pool, rt);
 			return (EEXIST);
 		}
+		atomic_inc_long(&rt_generation);
 		ifp->if_rtrequest(ifp, req, rt);
 
 		if_group_routechange(info->rti_info[RTAX_DST],
@@ -1750,6 +1758,7 @@ rt_if_linkstate_change(struct rtentry *rt, void *arg, u_int id)
 		error = rtable_mpath_reprio(id, rt_key(rt), rt_plen(rt),
 		    rt->rt_priority | RTP_DOWN, rt);
 	}
+	atomic_inc_long(&rt_generation);
 	if_group_routechange(rt_key(rt), rt_plen2mask(rt, &sa_mask));
 
 	return (error);
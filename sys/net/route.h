@@ -407,6 +407,7 @@ void		 rtlabel_unref(u_int16_t);
 #define	RT_RESOLVE	1
 
 extern struct rtstat rtstat;
+extern u_long rt_generation;
 
 struct mbuf;
 struct socket;
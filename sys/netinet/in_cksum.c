@@ -97,17 +97,34 @@ in_cksum(struct mbuf *m, int len)
 			byte_swapped = 1;
 		}
 		/*
-		 * Unroll the loop to make overhead from
-		 * branches &c small.
+		 * Sum 32 bytes at a time using 32-bit loads into a
+		 * 64-bit accumulator.  The ones' complement sum is
+		 * preserved by wider loads on either endianness (RFC
+		 * 1071 section 2) and this halves the loads compared
+		 * to the old 16-bit unrolled loop.
 		 */
-		while ((mlen -= 32) >= 0) {
-			sum += w[0]; sum += w[1]; sum += w[2]; sum += w[3];
-			sum += w[4]; sum += w[5]; sum += w[6]; sum += w[7];
-			sum += w[8]; sum += w[9]; sum += w[10]; sum += w[11];
-			sum += w[12]; sum += w[13]; sum += w[14]; sum += w[15];
-			w += 16;
+		if (mlen >= 32) {
+			uint64_t lsum = 0;
+			uint32_t *lw;
+
+			if (2 & (long)w) {
+				sum += *w++;
+				mlen -= 2;
+			}
+			lw = (uint32_t *)w;
+			while ((mlen -= 32) >= 0) {
+				lsum += lw[0]; lsum += lw[1];
+				lsum += lw[2]; lsum += lw[3];
+				lsum += lw[4]; lsum += lw[5];
+				lsum += lw[6]; lsum += lw[7];
+				lw += 8;
+			}
+			mlen += 32;
+			w = (uint16_t *)lw;
+			lsum = (lsum & 0xffffffff) + (lsum >> 32);
+			lsum = (lsum & 0xffffffff) + (lsum >> 32);
+			sum += (lsum & 0xffff) + (lsum >> 16);
 		}
-		mlen += 32;
 		while ((mlen -= 8) >= 0) {
 			sum += w[0]; sum += w[1]; sum += w[2]; sum += w[3];
 			w += 4;
@@ -132,6 +132,7 @@ in_init(void)
 {
 	pool_init(&inpcb_pool, sizeof(struct inpcb), 0,
 	    IPL_SOFTNET, 0, "inpcb", NULL);
+	pool_cache_init(&inpcb_pool);
 }
 
 struct inpcbhead *
@@ -240,6 +241,7 @@ in_pcballoc(struct socket *so, struct inpcbtable *table)
 	inp->inp_seclevel[SL_IPCOMP] = IPSEC_IPCOMP_LEVEL_DEFAULT;
 	inp->inp_rtableid = curproc->p_p->ps_rtableid;
 	inp->inp_hops = -1;
+	inp->inp_flowid = M_FLOWID_VALID | (arc4random() & M_FLOWID_MASK);
 #ifdef INET6
 	/*
 	 * Small change in this function to set the INP_IPV6 flag so routines
@@ -46,6 +46,7 @@
 #include <sys/sysctl.h>
 #include <sys/pool.h>
 #include <sys/task.h>
+#include <sys/percpu.h>
 
 #include <net/if.h>
 #include <net/if_var.h>
@@ -114,6 +115,24 @@ struct pool ipq_pool;
 
 struct cpumem *ipcounters;
 
+/*
+ * Per-cpu cache of the route used for the last forwarded packet.
+ * An entry is only used while `ipfc_gen' matches rt_generation, so
+ * any change to the routing tables invalidates all caches.  The
+ * mutex makes the cache safe against threads migrating between
+ * cpumem_enter() and cpumem_leave(); it is never contended in the
+ * common case.
+ */
+struct ipfwd_cache {
+	struct mutex	 ipfc_mtx;
+	struct rtentry	*ipfc_rt;
+	u_long		 ipfc_gen;
+	u_int		 ipfc_rtableid;
+	u_int32_t	 ipfc_dst;
+};
+
+struct cpumem	*ipfwd_cache;
+
 int ip_sysctl_ipstat(void *, size_t *, void *);
 
 static struct mbuf_queue	ipsend_mq;
@@ -123,6 +142,7 @@ extern struct niqueue		arpinq;
 int	ip_ours(struct mbuf **, int *, int, int);
 int	ip_dooptions(struct mbuf *, struct ifnet *);
 int	in_ouraddr(struct mbuf *, struct ifnet *, struct rtentry **);
+struct rtentry *ip_forward_route(struct sockaddr_in *, u_int32_t, u_int);
 
 static void ip_send_dispatch(void *);
 static struct task ipsend_task = TASK_INITIALIZER(ip_send_dispatch, &ipsend_mq);
@@ -151,6 +171,8 @@ void
 ip_init(void)
 {
 	const struct protosw *pr;
+	struct ipfwd_cache *ipfc;
+	struct cpumem_iter cmi;
 	int i;
 	const u_int16_t defbaddynamicports_tcp[] = DEFBADDYNAMICPORTS_TCP;
 	const u_int16_t defbaddynamicports_udp[] = DEFBADDYNAMICPORTS_UDP;
@@ -159,6 +181,10 @@ ip_init(void)
 
 	ipcounters = counters_alloc(ips_ncounters);
 
+	ipfwd_cache = cpumem_malloc(sizeof(*ipfc), M_RTABLE);
+	CPUMEM_FOREACH(ipfc, &cmi, ipfwd_cache)
+		mtx_init(&ipfc->ipfc_mtx, IPL_SOFTNET);
+
 	pool_init(&ipqent_pool, sizeof(struct ipqent), 0,
 	    IPL_SOFTNET, 0, "ipqe",  NULL);
 	pool_init(&ipq_pool, sizeof(struct ipq), 0,
@@ -199,6 +225,9 @@ ip_init(void)
 #ifdef IPSEC
 	ipsec_init();
 #endif
+#ifdef MROUTING
+	mrt_init();
+#endif
 }
 
 /*
@@ -1350,6 +1379,56 @@ const u_char inetctlerrmap[PRC_NCMDS] = {
 	ENOPROTOOPT
 };
 
+/*
+ * Find the route to forward to `sin', preferring the per-cpu cache
+ * over a full routing table lookup.
+ */
+struct rtentry *
+ip_forward_route(struct sockaddr_in *sin, u_int32_t src, u_int rtableid)
+{
+	struct ipfwd_cache *ipfc;
+	struct rtentry *rt = NULL, *ort = NULL;
+	u_long gen = rt_generation;
+
+	ipfc = cpumem_enter(ipfwd_cache);
+	mtx_enter(&ipfc->ipfc_mtx);
+	if (ipfc->ipfc_rt != NULL && ipfc->ipfc_gen == gen &&
+	    ipfc->ipfc_dst == sin->sin_addr.s_addr &&
+	    ipfc->ipfc_rtableid == rtableid &&
+	    rtisvalid(ipfc->ipfc_rt)) {
+		rt = ipfc->ipfc_rt;
+		rtref(rt);
+	}
+	mtx_leave(&ipfc->ipfc_mtx);
+	cpumem_leave(ipfwd_cache, ipfc);
+	if (rt != NULL)
+		return (rt);
+
+	rt = rtalloc_mpath(sintosa(sin), &src, rtableid);
+	if (rt == NULL)
+		return (NULL);
+
+	/*
+	 * Multipath routes are not cached, caching one leg would
+	 * defeat the load balancing.
+	 */
+	if (!ISSET(rt->rt_flags, RTF_MPATH)) {
+		ipfc = cpumem_enter(ipfwd_cache);
+		mtx_enter(&ipfc->ipfc_mtx);
+		ort = ipfc->ipfc_rt;
+		rtref(rt);
+		ipfc->ipfc_rt = rt;
+		ipfc->ipfc_gen = gen;
+		ipfc->ipfc_dst = sin->sin_addr.s_addr;
+		ipfc->ipfc_rtableid = rtableid;
+		mtx_leave(&ipfc->ipfc_mtx);
+		cpumem_leave(ipfwd_cache, ipfc);
+		rtfree(ort);
+	}
+
+	return (rt);
+}
+
 /*
  * Forward a packet.  If some error occurs return the sender
  * an icmp packet.  Note we can't always generate a meaningful
@@ -1393,7 +1472,7 @@ ip_forward(struct mbuf *m, struct ifnet *ifp, struct rtentry *rt, int srcrt)
 
 	if (!rtisvalid(rt)) {
 		rtfree(rt);
-		rt = rtalloc_mpath(sintosa(sin), &ip->ip_src.s_addr,
+		rt = ip_forward_route(sin, ip->ip_src.s_addr,
 		    m->m_pkthdr.ph_rtableid);
 		if (rt == NULL) {
 			icmp_error(m, ICMP_UNREACH, ICMP_UNREACH_HOST, dest, 0);
@@ -1537,7 +1616,6 @@ ip_sysctl(int *name, u_int namelen, void *oldp, size_t *oldlenp, void *newp,
 	int error;
 #ifdef MROUTING
 	extern int ip_mrtproto;
-	extern struct mrtstat mrtstat;
 #endif
 
 	/* Almost all sysctl names at this level are terminal. */
@@ -1608,8 +1686,7 @@ ip_sysctl(int *name, u_int namelen, void *oldp, size_t *oldlenp, void *newp,
 		return (ip_sysctl_ipstat(oldp, oldlenp, newp));
 #ifdef MROUTING
 	case IPCTL_MRTSTATS:
-		return (sysctl_rdstruct(oldp, oldlenp, newp,
-		    &mrtstat, sizeof(mrtstat)));
+		return (mrt_sysctl_mrtstat(oldp, oldlenp, newp));
 	case IPCTL_MRTPROTO:
 		return (sysctl_rdint(oldp, oldlenp, newp, ip_mrtproto));
 	case IPCTL_MRTMFC:
@@ -64,6 +64,7 @@
 #include <sys/protosw.h>
 #include <sys/ioctl.h>
 #include <sys/syslog.h>
+#include <sys/sysctl.h>
 
 #include <net/if.h>
 #include <net/if_var.h>
@@ -100,7 +101,13 @@ struct rttimer_queue *mrouterq[RT_TABLEID_MAX + 1];
 uint64_t	 mrt_count[RT_TABLEID_MAX + 1];
 int		ip_mrtproto = IGMP_DVMRP;    /* for netstat only */
 
-struct mrtstat	mrtstat;
+struct cpumem *mrtcounters;
+
+void
+mrt_init(void)
+{
+	mrtcounters = counters_alloc(mrts_ncounters);
+}
 
 struct rtentry	*mfc_find(struct ifnet *, struct in_addr *,
     struct in_addr *, unsigned int);
@@ -493,6 +500,25 @@ mrt_sysctl_mfc(void *oldp, size_t *oldlenp)
 	return (0);
 }
 
+int
+mrt_sysctl_mrtstat(void *oldp, size_t *oldlenp, void *newp)
+{
+	uint64_t counters[mrts_ncounters];
+	struct mrtstat mrtstat;
+	u_long *words = (u_long *)&mrtstat;
+	int i;
+
+	CTASSERT(sizeof(mrtstat) == (nitems(counters) * sizeof(u_long)));
+	memset(&mrtstat, 0, sizeof mrtstat);
+	counters_read(mrtcounters, counters, nitems(counters));
+
+	for (i = 0; i < nitems(counters); i++)
+		words[i] = (u_long)counters[i];
+
+	return (sysctl_rdstruct(oldp, oldlenp, newp,
+	    &mrtstat, sizeof(mrtstat)));
+}
+
 /*
  * Enable multicast routing
  */
@@ -1112,7 +1138,7 @@ ip_mforward(struct mbuf *m, struct ifnet *ifp)
 	/*
 	 * Determine forwarding vifs from the forwarding cache table
 	 */
-	++mrtstat.mrts_mfc_lookups;
+	mrtstat_inc(mrts_mfc_lookups);
 	rt = mfc_find(NULL, &ip->ip_src, &ip->ip_dst, rtableid);
 
 	/* Entry exists, so forward if necessary */
@@ -1125,8 +1151,8 @@ ip_mforward(struct mbuf *m, struct ifnet *ifp)
 		 */
 		int hlen = ip->ip_hl << 2;
 
-		++mrtstat.mrts_mfc_misses;
-		mrtstat.mrts_no_route++;
+		mrtstat_inc(mrts_mfc_misses);
+		mrtstat_inc(mrts_no_route);
 
 		{
 			struct igmpmsg *im;
@@ -1157,13 +1183,13 @@ ip_mforward(struct mbuf *m, struct ifnet *ifp)
 			im->im_mbz = 0;
 			im->im_vif = v->v_id;
 
-			mrtstat.mrts_upcalls++;
+			mrtstat_inc(mrts_upcalls);
 
 			sin.sin_addr = ip->ip_src;
 			if (socket_send(ip_mrouter[rtableid], mm, &sin) < 0) {
 				log(LOG_WARNING, "ip_mforward: ip_mrouter "
 				    "socket queue full\n");
-				++mrtstat.mrts_upq_sockfull;
+				mrtstat_inc(mrts_upq_sockfull);
 				return (ENOBUFS);
 			}
 
@@ -1199,7 +1225,7 @@ ip_mdq(struct mbuf *m, struct ifnet *ifp0, struct rtentry *rt)
 	 */
 	if (mfc->mfc_parent != v->v_id) {
 		/* came in the wrong interface */
-		++mrtstat.mrts_wrong_if;
+		mrtstat_inc(mrts_wrong_if);
 		mfc->mfc_wrong_if++;
 		rtfree(rt);
 		return (0);
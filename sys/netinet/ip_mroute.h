@@ -172,6 +172,33 @@ struct mrtstat {
 
 #ifdef _KERNEL
 
+#include <sys/percpu.h>
+
+enum mrtstat_counters {
+	mrts_mfc_lookups,	/* # forw. cache hash table hits */
+	mrts_mfc_misses,	/* # forw. cache hash table misses */
+	mrts_upcalls,		/* # calls to mrouted */
+	mrts_no_route,		/* no route for packet's origin */
+	mrts_bad_tunnel,	/* malformed tunnel options */
+	mrts_cant_tunnel,	/* no room for tunnel options */
+	mrts_wrong_if,		/* arrived on wrong interface */
+	mrts_upq_ovflw,		/* upcall Q overflow */
+	mrts_cache_cleanups,	/* # entries with no upcalls */
+	mrts_drop_sel,		/* pkts dropped selectively */
+	mrts_q_overflow,	/* pkts dropped - Q overflow */
+	mrts_pkt2large,		/* pkts dropped - size > BKT SIZE */
+	mrts_upq_sockfull,	/* upcalls dropped - socket full */
+	mrts_ncounters
+};
+
+extern struct cpumem *mrtcounters;
+
+static inline void
+mrtstat_inc(enum mrtstat_counters c)
+{
+	counters_inc(mrtcounters, c);
+}
+
 /* How frequent should we look for expired entries (in seconds). */
 #define MCAST_EXPIRE_FREQUENCY		30
 
@@ -225,9 +252,11 @@ struct igmpmsg {
 
 int	ip_mrouter_set(struct socket *, int, struct mbuf *);
 int	ip_mrouter_get(struct socket *, int, struct mbuf *);
+void	mrt_init(void);
 int	mrt_ioctl(struct socket *, u_long, caddr_t);
 int	mrt_sysctl_vif(void *, size_t *);
 int	mrt_sysctl_mfc(void *, size_t *);
+int	mrt_sysctl_mrtstat(void *, size_t *, void *);
 int	ip_mrouter_done(struct socket *);
 void	vif_delete(struct ifnet *);
 
@@ -2387,6 +2387,8 @@ tcp_sack_option(struct tcpcb *tp, struct tcphdr *th, u_char *cp, int optlen)
 	tmp_cp = cp + 2;
 	tmp_olen = optlen - 2;
 	tcpstat_inc(tcps_sack_rcv_opts);
+	/* The hole list may change below, invalidate the output hint. */
+	tp->snd_sackhint = NULL;
 	if (tp->snd_numholes < 0)
 		tp->snd_numholes = 0;
 	if (tp->t_maxseg == 0)
@@ -2573,6 +2575,7 @@ tcp_del_sackholes(struct tcpcb *tp, struct tcphdr *th)
 			} else
 				break;
 		tp->snd_holes = cur;
+		tp->snd_sackhint = NULL;
 	}
 }
 
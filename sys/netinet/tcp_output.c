@@ -132,7 +132,16 @@ tcp_sack_output(struct tcpcb *tp)
 
 	if (!tp->sack_enable)
 		return (NULL);
-	p = tp->snd_holes;
+	/*
+	 * tcp_output() calls us once per segment while retransmitting,
+	 * so resume the scan at the hole we handed out last instead of
+	 * walking the whole list every time.  The hint is cleared
+	 * wherever holes may be freed.
+	 */
+	p = tp->snd_sackhint;
+	if (p == NULL)
+		p = tp->snd_holes;
+ again:
 	while (p) {
 		if (p->dups >= tcprexmtthresh && SEQ_LT(p->rxmit, p->end)) {
 			if (SEQ_LT(p->rxmit, tp->snd_una)) {/* old SACK hole */
@@ -143,10 +152,16 @@ tcp_sack_output(struct tcpcb *tp)
 			if (p)
 				tcp_print_holes(tp);
 #endif
+			tp->snd_sackhint = p;
 			return (p);
 		}
 		p = p->next;
 	}
+	if (tp->snd_sackhint != NULL) {
+		tp->snd_sackhint = NULL;
+		p = tp->snd_holes;
+		goto again;
+	}
 	return (NULL);
 }
 
@@ -1017,6 +1032,9 @@ send:
 	/* force routing table */
 	m->m_pkthdr.ph_rtableid = tp->t_inpcb->inp_rtableid;
 
+	/* tell flow queueing disciplines which connection this is */
+	m->m_pkthdr.ph_flowid = tp->t_inpcb->inp_flowid;
+
 #if NPF > 0
 	pf_mbuf_link_inpcb(m, tp->t_inpcb);
 #endif
@@ -515,6 +515,8 @@ tcp_close(struct tcpcb *tp)
 		pool_put(&sackhl_pool, p);
 		p = q;
 	}
+	tp->snd_holes = NULL;
+	tp->snd_sackhint = NULL;
 
 	m_free(tp->t_template);
 	/* Free tcpcb after all pending timers have been run. */
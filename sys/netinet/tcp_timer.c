@@ -190,6 +190,7 @@ tcp_timer_freesack(struct tcpcb *tp)
 		pool_put(&sackhl_pool, p);
 	}
 	tp->snd_holes = 0;
+	tp->snd_sackhint = NULL;
 }
 
 void
@@ -1176,10 +1176,16 @@ tcp_update_rcvspace(struct tcpcb *tp)
 		/* user requested buffer size, auto-scaling disabled */
 		nmax = so->so_rcv.sb_wat;
 	else {
-		/* automatic buffer scaling */
+		/*
+		 * Automatic buffer scaling.  Grow by half the current
+		 * size per measured RTT so long fat pipes open up in a
+		 * dozen round trips instead of creeping towards sb_max
+		 * in fixed increments.
+		 */
 		if (tp->rfbuf_cnt > so->so_rcv.sb_hiwat / 8 * 7)
 			nmax = MIN(sb_max, so->so_rcv.sb_hiwat +
-			    tcp_autorcvbuf_inc);
+			    MAX(tcp_autorcvbuf_inc,
+			    so->so_rcv.sb_hiwat / 2));
 	}
 
 	/* a readable socket must be preserved because of poll(2) semantics */
@@ -996,6 +996,9 @@ udp_output(struct inpcb *inp, struct mbuf *m, struct mbuf *addr,
 	/* force routing table */
 	m->m_pkthdr.ph_rtableid = inp->inp_rtableid;
 
+	/* tell flow queueing disciplines which socket this is */
+	m->m_pkthdr.ph_flowid = inp->inp_flowid;
+
 #if NPF > 0
 	if (inp->inp_socket->so_state & SS_ISCONNECTED)
 		pf_mbuf_link_inpcb(m, inp);
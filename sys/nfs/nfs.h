@@ -50,11 +50,11 @@
 #define	NFS_MAXGRPS	16		/* Max. size of groups list */
 #define	NFS_MINATTRTIMO 5		/* Attribute cache timeout in sec */
 #define	NFS_MAXATTRTIMO 60
-#define	NFS_WSIZE	8192		/* Def. write data size <= 8192 */
-#define	NFS_RSIZE	8192		/* Def. read data size <= 8192 */
+#define	NFS_WSIZE	32768		/* Def. write data size <= 32768 */
+#define	NFS_RSIZE	32768		/* Def. read data size <= 32768 */
 #define NFS_READDIRSIZE	8192		/* Def. readdir size */
-#define	NFS_DEFRAHEAD	1		/* Def. read ahead # blocks */
-#define	NFS_MAXRAHEAD	4		/* Max. read ahead # blocks */
+#define	NFS_DEFRAHEAD	4		/* Def. read ahead # blocks */
+#define	NFS_MAXRAHEAD	16		/* Max. read ahead # blocks */
 #define	NFS_MAXASYNCDAEMON 	20	/* Max. number async_daemons runable */
 
 /*
@@ -31,7 +31,7 @@
 #ifndef _SYS_EVENTVAR_H_
 #define _SYS_EVENTVAR_H_
 
-#define KQ_NEVENTS	8		/* minimize copy{in,out} calls */
+#define KQ_NEVENTS	32		/* minimize copy{in,out} calls */
 #define KQEXTENT	256		/* linear growth by this amount */
 
 struct kqueue {
@@ -128,6 +128,13 @@ struct cpustats {
 
 #define CPUSTATS_ONLINE		0x0001	/* CPU is schedulable */
 
+/*
+ * Pass this instead of a CPU number to KERN_CPUSTATS to read the
+ * statistics of all CPUs in one call.  The reply is an array of
+ * struct cpustats indexed by CPU number, hw.ncpufound entries long.
+ */
+#define KERN_CPUSTATS_ALL	(-1)
+
 #ifdef	_KERNEL
 
 /* spc_flags */
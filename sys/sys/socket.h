@@ -460,6 +460,15 @@ struct msghdr {
 	int		msg_flags;	/* flags on received message */
 };
 
+/*
+ * Message header for recvmmsg and sendmmsg calls.  msg_len is
+ * filled in with the number of bytes transferred per message.
+ */
+struct mmsghdr {
+	struct msghdr	msg_hdr;
+	unsigned int	msg_len;
+};
+
 #define	MSG_OOB			0x1	/* process out-of-band data */
 #define	MSG_PEEK		0x2	/* peek at incoming message */
 #define	MSG_DONTROUTE		0x4	/* send without using routing tables */
@@ -472,6 +481,7 @@ struct msghdr {
 #define	MSG_MCAST		0x200	/* this message rec'd as multicast */
 #define	MSG_NOSIGNAL		0x400	/* do not send SIGPIPE */
 #define	MSG_CMSG_CLOEXEC	0x800	/* set FD_CLOEXEC on received fds */
+#define	MSG_WAITFORONE		0x1000	/* nonblocking after first message */
 
 /*
  * Header for ancillary data objects in msg_control buffer.
@@ -524,6 +534,8 @@ struct cmsghdr {
 
 #ifndef _KERNEL
 
+struct timespec;
+
 __BEGIN_DECLS
 int	accept(int, struct sockaddr *, socklen_t *);
 int	bind(int, const struct sockaddr *, socklen_t);
@@ -535,10 +547,12 @@ int	listen(int, int);
 ssize_t	recv(int, void *, size_t, int);
 ssize_t	recvfrom(int, void *, size_t, int, struct sockaddr *, socklen_t *);
 ssize_t	recvmsg(int, struct msghdr *, int);
+int	recvmmsg(int, struct mmsghdr *, unsigned int, int, struct timespec *);
 ssize_t	send(int, const void *, size_t, int);
 ssize_t	sendto(int, const void *,
 	    size_t, int, const struct sockaddr *, socklen_t);
 ssize_t	sendmsg(int, const struct msghdr *, int);
+int	sendmmsg(int, struct mmsghdr *, unsigned int, int);
 int	setsockopt(int, int, int, const void *, socklen_t);
 int	shutdown(int, int);
 int	sockatmark(int);
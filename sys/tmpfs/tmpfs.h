@@ -45,6 +45,7 @@
 #include <sys/stdint.h>
 #include <sys/rwlock.h>
 #include <sys/lock.h>
+#include <sys/tree.h>
 
 #include <uvm/uvm_extern.h>
 
@@ -56,6 +57,9 @@
 typedef struct tmpfs_dirent {
 	TAILQ_ENTRY(tmpfs_dirent)	td_entries;
 
+	/* Name index of the parent directory, see tmpfs_dir_lookup(). */
+	RBT_ENTRY(tmpfs_dirent)		td_tree;
+
 	/* Pointer to the inode this entry refers to. */
 	struct tmpfs_node *		td_node;
 
@@ -65,9 +69,16 @@ typedef struct tmpfs_dirent {
 	/* Name and its length. */
 	char *				td_name;
 	uint16_t			td_namelen;
+
+	/* Whether the entry is in its parent's name index. */
+	uint16_t			td_indexed;
 } tmpfs_dirent_t;
 
 TAILQ_HEAD(tmpfs_dir, tmpfs_dirent);
+RBT_HEAD(tmpfs_dir_tree, tmpfs_dirent);
+
+int	tmpfs_dirtree_cmp(const tmpfs_dirent_t *, const tmpfs_dirent_t *);
+RBT_PROTOTYPE(tmpfs_dir_tree, tmpfs_dirent, td_tree, tmpfs_dirtree_cmp);
 
 /*
  * Internal representation of a tmpfs file system node -- inode.
@@ -138,6 +149,9 @@ typedef struct tmpfs_node {
 			/* List of directory entries. */
 			struct tmpfs_dir	tn_dir;
 
+			/* Entries indexed by name for fast lookup. */
+			struct tmpfs_dir_tree	tn_dirtree;
+
 			/* Last given sequence number. */
 			uint64_t		tn_next_seq;
 
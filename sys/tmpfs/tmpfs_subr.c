@@ -96,6 +96,21 @@
 void	tmpfs_dir_putseq(tmpfs_node_t *, tmpfs_dirent_t *);
 int	tmpfs_dir_getdotents(tmpfs_node_t *, struct dirent *, struct uio *);
 
+/*
+ * Red-black tree of the directory entries, indexed by name.  The entry
+ * list (tmpfs_dir) stays in insertion order for readdir; the tree keeps
+ * lookup, create and remove logarithmic in large directories.
+ */
+int
+tmpfs_dirtree_cmp(const tmpfs_dirent_t *a, const tmpfs_dirent_t *b)
+{
+	if (a->td_namelen != b->td_namelen)
+		return a->td_namelen < b->td_namelen ? -1 : 1;
+	return memcmp(a->td_name, b->td_name, a->td_namelen);
+}
+
+RBT_GENERATE(tmpfs_dir_tree, tmpfs_dirent, td_tree, tmpfs_dirtree_cmp);
+
 /*
  * tmpfs_alloc_node: allocate a new inode of a specified type and
  * insert it into the list of specified mount point.
@@ -157,6 +172,7 @@ tmpfs_alloc_node(tmpfs_mount_t *tmp, enum vtype type, uid_t uid, gid_t gid,
 	case VDIR:
 		/* Directory. */
 		TAILQ_INIT(&nnode->tn_spec.tn_dir.tn_dir);
+		RBT_INIT(tmpfs_dir_tree, &nnode->tn_spec.tn_dir.tn_dirtree);
 		nnode->tn_spec.tn_dir.tn_parent = NULL;
 		nnode->tn_spec.tn_dir.tn_next_seq = TMPFS_DIRSEQ_START;
 		nnode->tn_spec.tn_dir.tn_readdir_lastp = NULL;
@@ -451,6 +467,7 @@ tmpfs_alloc_dirent(tmpfs_mount_t *tmp, const char *name, uint16_t len,
 	nde->td_namelen = len;
 	memcpy(nde->td_name, name, len);
 	nde->td_seq = TMPFS_DIRSEQ_NONE;
+	nde->td_indexed = 0;
 
 	*de = nde;
 	return 0;
@@ -501,6 +518,11 @@ tmpfs_dir_attach(tmpfs_node_t *dnode, tmpfs_dirent_t *de, tmpfs_node_t *node)
 
 	/* Insert the entry to the directory (parent of inode). */
 	TAILQ_INSERT_TAIL(&dnode->tn_spec.tn_dir.tn_dir, de, td_entries);
+	if (RBT_INSERT(tmpfs_dir_tree, &dnode->tn_spec.tn_dir.tn_dirtree,
+	    de) != NULL)
+		panic("%s: duplicate entry %.*s", __func__,
+		    (int)de->td_namelen, de->td_name);
+	de->td_indexed = 1;
 	dnode->tn_size += sizeof(tmpfs_dirent_t);
 	tmpfs_update(dnode, TMPFS_NODE_STATUSALL);
 	uvm_vnp_setsize(dvp, dnode->tn_size);
@@ -563,6 +585,11 @@ tmpfs_dir_detach(tmpfs_node_t *dnode, tmpfs_dirent_t *de)
 		dnode->tn_spec.tn_dir.tn_readdir_lastp = NULL;
 	}
 	TAILQ_REMOVE(&dnode->tn_spec.tn_dir.tn_dir, de, td_entries);
+	if (de->td_indexed) {
+		RBT_REMOVE(tmpfs_dir_tree, &dnode->tn_spec.tn_dir.tn_dirtree,
+		    de);
+		de->td_indexed = 0;
+	}
 
 	dnode->tn_size -= sizeof(tmpfs_dirent_t);
 	tmpfs_update(dnode, TMPFS_NODE_MODIFIED | TMPFS_NODE_CHANGED);
@@ -585,20 +612,16 @@ tmpfs_dir_lookup(tmpfs_node_t *node, struct componentname *cnp)
 {
 	const char *name = cnp->cn_nameptr;
 	const uint16_t nlen = cnp->cn_namelen;
-	tmpfs_dirent_t *de;
+	tmpfs_dirent_t *de, key;
 
 	KASSERT(VOP_ISLOCKED(node->tn_vnode));
 	KASSERT(nlen != 1 || !(name[0] == '.'));
 	KASSERT(nlen != 2 || !(name[0] == '.' && name[1] == '.'));
 	TMPFS_VALIDATE_DIR(node);
 
-	TAILQ_FOREACH(de, &node->tn_spec.tn_dir.tn_dir, td_entries) {
-		if (de->td_namelen != nlen)
-			continue;
-		if (memcmp(de->td_name, name, nlen) != 0)
-			continue;
-		break;
-	}
+	key.td_name = (char *)name;
+	key.td_namelen = nlen;
+	de = RBT_FIND(tmpfs_dir_tree, &node->tn_spec.tn_dir.tn_dirtree, &key);
 	tmpfs_update(node, TMPFS_NODE_ACCESSED);
 	return de;
 }
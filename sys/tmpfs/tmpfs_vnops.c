@@ -1552,20 +1552,21 @@ tmpfs_sane_rename(struct vnode *fdvp, struct componentname *fcnp,
 		goto out_locked;
 
 	/*
-	 * Everything is hunky-dory.  Shuffle the directory entries.
-	 */
-	tmpfs_rename_attachdetach(tmpfs, fdvp, fde, fvp, tdvp, tde, tvp);
-
-	/*
-	 * Update the directory entry's name necessary, and flag
-	 * metadata updates.  A memory allocation failure here is not
-	 * OK because we've already committed some changes that we
-	 * can't back out at this point, and we have things locked so
-	 * we can't sleep, hence the early allocation above.
+	 * Everything is hunky-dory.  Update the directory entry's name
+	 * if necessary, and flag metadata updates.  A memory allocation
+	 * failure here is not OK because we've already committed some
+	 * changes that we can't back out at this point, and we have
+	 * things locked so we can't sleep, hence the early allocation
+	 * above.  The entry is taken out of its directory's name index
+	 * across the change; it is reinserted under the final name
+	 * below, once any entry it replaces is gone.
 	 */
 	if (newname != NULL) {
 		KASSERT(tcnp->cn_namelen <= TMPFS_MAXNAMLEN);
 
+		RBT_REMOVE(tmpfs_dir_tree,
+		    &fdnode->tn_spec.tn_dir.tn_dirtree, fde);
+		fde->td_indexed = 0;
 		tmpfs_strname_free(tmpfs, fde->td_name, fde->td_namelen);
 		fde->td_namelen = (uint16_t)tcnp->cn_namelen;
 		(void)memcpy(newname, tcnp->cn_nameptr, tcnp->cn_namelen);
@@ -1577,6 +1578,24 @@ tmpfs_sane_rename(struct vnode *fdvp, struct componentname *fcnp,
 		tmpfs_update(tdnode, TMPFS_NODE_MODIFIED);
 	}
 
+	/*
+	 * Shuffle the directory entries.
+	 */
+	tmpfs_rename_attachdetach(tmpfs, fdvp, fde, fvp, tdvp, tde, tvp);
+
+	/*
+	 * A rename within the same directory does not pass through
+	 * tmpfs_dir_attach(), so the entry may still be out of the
+	 * name index; put it back under its new name.
+	 */
+	if (!fde->td_indexed) {
+		if (RBT_INSERT(tmpfs_dir_tree,
+		    &tdnode->tn_spec.tn_dir.tn_dirtree, fde) != NULL)
+			panic("%s: duplicate entry %.*s", __func__,
+			    (int)fde->td_namelen, fde->td_name);
+		fde->td_indexed = 1;
+	}
+
 success:
 	VN_KNOTE(fvp, NOTE_RENAME);
 	tmpfs_rename_cache_purge(fdvp, fvp, tdvp, tvp);
@@ -2219,6 +2238,27 @@ tmpfs_rename_attachdetach(struct tmpfs_mount *tmpfs,
 	KASSERT(VOP_ISLOCKED(fvp) == LK_EXCLUSIVE);
 	KASSERT((tvp == NULL) || (VOP_ISLOCKED(tvp) == LK_EXCLUSIVE));
 
+	/*
+	 * If we are replacing an existing target entry, delete it
+	 * first, so that attaching the source entry under the target
+	 * name never creates a duplicate in the name index.
+	 */
+	if (tde != NULL) {
+		tmpfs_node_t *tdnode = VP_TO_TMPFS_DIR(tdvp);
+		KASSERT(tvp != NULL);
+		KASSERT(tde->td_node != NULL);
+		KASSERT((fvp->v_type == VDIR) == (tvp->v_type == VDIR));
+		if (tde->td_node->tn_type == VDIR) {
+			KASSERT(tde->td_node->tn_size == 0);
+			KASSERT(tde->td_node->tn_links == 2);
+			/* Decrement the extra link count for `.' so
+			 * the vnode will be recycled when released.  */
+			tde->td_node->tn_links--;
+		}
+		tmpfs_dir_detach(tdnode, tde);
+		tmpfs_free_dirent(tmpfs, tde);
+	}
+
 	/*
 	 * If we are moving from one directory to another, detach the
 	 * source entry and reattach it to the target directory.
@@ -2239,25 +2279,6 @@ tmpfs_rename_attachdetach(struct tmpfs_mount *tmpfs,
 		 */
 		VN_KNOTE(fdvp, NOTE_WRITE);
 	}
-
-	/*
-	 * If we are replacing an existing target entry, delete it.
-	 */
-	if (tde != NULL) {
-		tmpfs_node_t *tdnode = VP_TO_TMPFS_DIR(tdvp);
-		KASSERT(tvp != NULL);
-		KASSERT(tde->td_node != NULL);
-		KASSERT((fvp->v_type == VDIR) == (tvp->v_type == VDIR));
-		if (tde->td_node->tn_type == VDIR) {
-			KASSERT(tde->td_node->tn_size == 0);
-			KASSERT(tde->td_node->tn_links == 2);
-			/* Decrement the extra link count for `.' so
-			 * the vnode will be recycled when released.  */
-			tde->td_node->tn_links--;
-		}
-		tmpfs_dir_detach(tdnode, tde);
-		tmpfs_free_dirent(tmpfs, tde);
-	}
 }
 
 /*
@@ -66,6 +66,7 @@
 daddr_t		ffs_alloccg(struct inode *, int, daddr_t, int);
 struct buf *	ffs_cgread(struct fs *, struct inode *, int);
 daddr_t		ffs_alloccgblk(struct inode *, struct buf *, daddr_t);
+daddr_t		ffs_clusterhint(struct fs *, struct cg *, daddr_t);
 ufsino_t	ffs_dirpref(struct inode *);
 daddr_t		ffs_fragextend(struct inode *, int, daddr_t, int, int);
 daddr_t		ffs_hashalloc(struct inode *, int, daddr_t, int,
@@ -1045,10 +1046,23 @@ ffs_alloccgblk(struct inode *ip, struct buf *bp, daddr_t bpref)
 	bno = dtogd(fs, blknum(fs, bpref));
 	if (ffs_isblock(fs, blksfree, fragstoblks(fs, bno)))
 		goto gotit;
+	/*
+	 * The preferred block is in use. If the cylinder group keeps
+	 * free cluster summaries, steer the allocation to the start of
+	 * a remaining run of free blocks instead of letting
+	 * ffs_mapsearch() hand back an isolated block. Sequential
+	 * writers then grow into the run one block at a time and large
+	 * files stay mostly contiguous as the filesystem ages.
+	 */
+	if (fs->fs_contigsumsize > 0)
+		bno = ffs_clusterhint(fs, cgp, bpref);
+	else
+		bno = -1;
 	/*
 	 * Take the next available block in this cylinder group.
 	 */
-	bno = ffs_mapsearch(fs, cgp, bpref, (int) fs->fs_frag);
+	if (bno < 0)
+		bno = ffs_mapsearch(fs, cgp, bpref, (int) fs->fs_frag);
 	if (bno < 0)
 		return (0);
 
@@ -1079,6 +1093,42 @@ gotit:
 	return (blkno);
 }
 
+/*
+ * Find the first free block at or after bpref that begins a run of at
+ * least two free blocks, using the free cluster map maintained by
+ * ffs_clusteracct(). Returns the cg-relative frag address of that
+ * block, or -1 if no such run exists past bpref. Handing out the head
+ * of a run means the next allocation for the same file finds its
+ * preferred block free, so large sequential files are laid out as
+ * extents even on an aged filesystem.
+ */
+daddr_t
+ffs_clusterhint(struct fs *fs, struct cg *cgp, daddr_t bpref)
+{
+	u_int8_t *clusfree;
+	int32_t *sump;
+	daddr_t blk, nblk;
+	int i;
+
+	/*
+	 * Check the cluster summary first; if only isolated blocks are
+	 * left there is no run to find.
+	 */
+	sump = cg_clustersum(cgp);
+	for (i = 2; i <= fs->fs_contigsumsize; i++)
+		if (sump[i] > 0)
+			break;
+	if (i > fs->fs_contigsumsize)
+		return (-1);
+	clusfree = cg_clustersfree(cgp);
+	nblk = cgp->cg_nclusterblks;
+	for (blk = fragstoblks(fs, dtogd(fs, blknum(fs, bpref)));
+	    blk < nblk - 1; blk++)
+		if (isset(clusfree, blk) && isset(clusfree, blk + 1))
+			return (blkstofrags(fs, blk));
+	return (-1);
+}
+
 /* inode allocation routine */
 daddr_t
 ffs_nodealloccg(struct inode *ip, int cg, daddr_t ipref, int mode)
@@ -44,6 +44,7 @@
 #include <sys/param.h>
 #include <sys/buf.h>
 #include <sys/kernel.h>
+#include <sys/kthread.h>
 #include <sys/malloc.h>
 #include <sys/mount.h>
 #include <sys/proc.h>
@@ -115,6 +116,8 @@ const char *softdep_typenames[] = {
  * Internal function prototypes.
  */
 STATIC	void softdep_error(char *, int);
+STATIC	void softdep_flush_create(void *);
+STATIC	void softdep_flush_thread(void *);
 STATIC	void drain_output(struct vnode *, int);
 STATIC	int getdirtybuf(struct buf *, int);
 STATIC	void clear_remove(struct proc *);
@@ -529,6 +532,9 @@ STATIC struct worklist *worklist_tail;
 STATIC int num_on_worklist;	/* number of worklist items to be processed */
 STATIC int softdep_worklist_busy; /* 1 => trying to do unmount */
 STATIC int softdep_worklist_req; /* serialized waiters */
+STATIC int softdep_worklist_active; /* worklist is being drained */
+STATIC struct proc *softdep_flushproc; /* dedicated worklist flush thread */
+STATIC int softdep_flush_req;	/* flush thread wakeup requested */
 STATIC int max_softdeps;	/* maximum number of structs before slowdown */
 STATIC int tickdelay = 2;	/* number of ticks to pause during slowdown */
 STATIC int proc_waiting;	/* tracks whether we have a timeout posted */
@@ -578,6 +584,17 @@ add_to_worklist(struct worklist *wk)
 		LIST_INSERT_AFTER(worklist_tail, wk, wk_list);
 	worklist_tail = wk;
 	num_on_worklist += 1;
+
+	/*
+	 * If the worklist is getting deep, ask the dedicated flush
+	 * thread to start draining it instead of waiting for the
+	 * next once-per-second syncer pass.
+	 */
+	if (num_on_worklist > max_softdeps / 10 &&
+	    softdep_flushproc != NULL && softdep_flush_req == 0) {
+		softdep_flush_req = 1;
+		wakeup(&softdep_flush_req);
+	}
 }
 
 /*
@@ -614,14 +631,19 @@ softdep_process_worklist(struct mount *matchmnt)
 	matchcnt = 0;
 
 	/*
-	 * There is no danger of having multiple processes run this
-	 * code, but we have to single-thread it when softdep_flushfiles()
-	 * is in operation to get an accurate count of the number of items
-	 * related to its mount point that are in the list.
+	 * Both the syncer and the dedicated flush thread may get here,
+	 * but the worklist must be drained by one process at a time to
+	 * preserve the ordering of the queued items. We also have to
+	 * single-thread it when softdep_flushfiles() is in operation to
+	 * get an accurate count of the number of items related to its
+	 * mount point that are in the list.
 	 */
 	if (matchmnt == NULL) {
 		if (softdep_worklist_busy < 0)
 			return(-1);
+		if (softdep_worklist_active)
+			return (0);
+		softdep_worklist_active = 1;
 		softdep_worklist_busy += 1;
 	}
 
@@ -698,6 +720,7 @@ softdep_process_worklist(struct mount *matchmnt)
 		FREE_LOCK(&lk);
 	}
 	if (matchmnt == NULL) {
+		softdep_worklist_active = 0;
 		softdep_worklist_busy -= 1;
 		if (softdep_worklist_req && softdep_worklist_busy == 0)
 			wakeup(&softdep_worklist_req);
@@ -705,6 +728,42 @@ softdep_process_worklist(struct mount *matchmnt)
 	return (matchcnt);
 }
 
+/*
+ * Kick off the dedicated worklist flush thread. Called via
+ * kthread_create_deferred() once process creation is possible.
+ */
+STATIC void
+softdep_flush_create(void *arg)
+{
+	if (kthread_create(softdep_flush_thread, NULL, &softdep_flushproc,
+	    "softdep"))
+		printf("softdep: unable to create flush thread\n");
+}
+
+/*
+ * Dedicated thread draining the worklist when it grows too deep for
+ * the once-per-second syncer pass to keep up. P_SOFTDEP exempts us
+ * from being co-opted by request_cleanup() while we are flushing.
+ */
+STATIC void
+softdep_flush_thread(void *arg)
+{
+	struct proc *p = curproc;
+
+	atomic_setbits_int(&p->p_flag, P_SOFTDEP);
+	for (;;) {
+		/*
+		 * Re-check the flag before sleeping: a producer may have
+		 * set it while softdep_process_worklist() slept, and that
+		 * wakeup found no sleeper.
+		 */
+		while (softdep_flush_req == 0)
+			tsleep(&softdep_flush_req, PRIBIO, "sdflush", 0);
+		softdep_flush_req = 0;
+		softdep_process_worklist(NULL);
+	}
+}
+
 /*
  * Process one item on the worklist.
  */
@@ -1183,6 +1242,7 @@ softdep_initialize(void)
 	newblk_hashtbl = hashinit(64, M_NEWBLK, M_WAITOK, &newblk_hash);
 	sema_init(&newblk_in_progress, "newblk", PRIBIO, 0);
 	timeout_set(&proc_waiting_timeout, pause_timer, NULL);
+	kthread_create_deferred(softdep_flush_create, NULL);
 	pool_init(&pagedep_pool, sizeof(struct pagedep), 0, IPL_NONE,
 	    PR_WAITOK, "pagedep", NULL);
 	pool_init(&inodedep_pool, sizeof(struct inodedep), 0, IPL_NONE,
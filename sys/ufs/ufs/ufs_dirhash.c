@@ -1048,12 +1048,26 @@ ufsdirhash_recycle(int wanted)
 void
 ufsdirhash_init(void)
 {
+	psize_t maxmem;
+
 	pool_init(&ufsdirhash_pool, DH_NBLKOFF * sizeof(doff_t), 0, IPL_NONE,
 	    PR_WAITOK, "dirhash", NULL);
 	rw_init(&ufsdirhash_mtx, "dirhash_list");
 	arc4random_buf(&ufsdirhash_key, sizeof(ufsdirhash_key));
 	TAILQ_INIT(&ufsdirhash_list);
-	ufs_dirhashmaxmem = 5 * 1024 * 1024;
+	/*
+	 * Scale the memory budget with the machine: a fixed 5MB limit
+	 * refuses to hash directories with a few hundred thousand
+	 * entries, which are precisely the ones that need it. Give
+	 * dirhash 1/64th of physical memory, with the old limit as the
+	 * floor and 64MB as the ceiling. Still tunable via sysctl.
+	 */
+	maxmem = ptoa((psize_t)physmem) / 64;
+	if (maxmem < 5 * 1024 * 1024)
+		maxmem = 5 * 1024 * 1024;
+	if (maxmem > 64 * 1024 * 1024)
+		maxmem = 64 * 1024 * 1024;
+	ufs_dirhashmaxmem = maxmem;
 	ufs_mindirhashsize = 5 * DIRBLKSIZ;
 }
 
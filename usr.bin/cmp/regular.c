@@ -47,8 +47,9 @@ void
 c_regular(int fd1, char *file1, off_t skip1, off_t len1,
     int fd2, char *file2, off_t skip2, off_t len2)
 {
-	u_char ch, *p1, *p2;
+	u_char ch, *p1, *p2, *q;
 	off_t byte, length, line;
+	size_t n;
 	int dfound;
 
 	if (sflag && len1 != len2)
@@ -82,18 +83,40 @@ c_regular(int fd1, char *file1, off_t skip1, off_t len1,
 	}
 
 	dfound = 0;
-	for (byte = line = 1; length--; ++p1, ++p2, ++byte) {
-		if ((ch = *p1) != *p2) {
-			if (lflag) {
-				dfound = 1;
-				(void)printf("%6lld %3o %3o\n", (long long)byte,
-				    ch, *p2);
-			} else
-				diffmsg(file1, file2, byte, line);
-				/* NOTREACHED */
+	byte = line = 1;
+	while (length > 0) {
+		/*
+		 * Skip over identical stretches a chunk at a time with
+		 * memcmp(), only dropping to the byte loop when a chunk
+		 * differs.  The line count is just for the first
+		 * difference message, so -l need not maintain it.
+		 */
+		n = MINIMUM(length, 8192);
+		if (memcmp(p1, p2, n) == 0) {
+			if (!lflag) {
+				for (q = p1; (q = memchr(q, '\n',
+				    n - (q - p1))) != NULL; ++q)
+					++line;
+			}
+			p1 += n;
+			p2 += n;
+			byte += n;
+			length -= n;
+			continue;
+		}
+		for (; n--; ++p1, ++p2, ++byte, --length) {
+			if ((ch = *p1) != *p2) {
+				if (lflag) {
+					dfound = 1;
+					(void)printf("%6lld %3o %3o\n",
+					    (long long)byte, ch, *p2);
+				} else
+					diffmsg(file1, file2, byte, line);
+					/* NOTREACHED */
+			}
+			if (ch == '\n')
+				++line;
 		}
-		if (ch == '\n')
-			++line;
 	}
 
 	if (len1 != len2)
@@ -608,6 +608,14 @@ grep_cmp(const char *pattern, const char *data, size_t len)
 {
 	size_t i;
 
+	/*
+	 * Plain fgrep patterns have no wildcards and no case folding
+	 * to deal with, so a straight memcmp() beats comparing byte
+	 * by byte.
+	 */
+	if (Fflag && !iflag)
+		return (memcmp(pattern, data, len) == 0);
+
 	for (i = 0; i < len; i++) {
 		if (((pattern[i] == data[i]) || (!Fflag && pattern[i] == '.'))
 		    || (iflag && pattern[i] == toupper((unsigned char)data[i])))
@@ -75,7 +75,7 @@
 #include "extern.h"
 
 int timestamp, decimal, iohex, fancy = 1, maxdata = INT_MAX;
-int needtid, tail, basecol;
+int needtid, tail, basecol, summary;
 char *tracefile = DEF_TRACEFILE;
 struct ktr_header ktr_header;
 pid_t pid_opt = -1;
@@ -103,6 +103,26 @@ pid_t pid_opt = -1;
 #undef ACCOUNTING
 
 
+/* Per-syscall accounting for the -S summary. */
+struct sc_stat {
+	u_int64_t	 calls;
+	u_int64_t	 errors;
+	struct timespec	 total;
+	struct timespec	 max;
+};
+static struct sc_stat sc_stats[SYS_MAXSYSCALL];
+
+/* Outstanding syscall per thread, to pair each RET with its CALL. */
+struct sc_pending {
+	pid_t		 pid;
+	pid_t		 tid;
+	int		 code;
+	int		 valid;
+	struct timespec	 when;
+	struct sc_pending *next;
+};
+static struct sc_pending *sc_pendings;
+
 static char *ptrace_ops[] = {
 	"PT_TRACE_ME",	"PT_READ_I",	"PT_READ_D",	"PT_READ_U",
 	"PT_WRITE_I",	"PT_WRITE_D",	"PT_WRITE_U",	"PT_CONTINUE",
@@ -119,6 +139,10 @@ static void ktrpsig(struct ktr_psig *);
 static void ktrsyscall(struct ktr_syscall *, size_t);
 static const char *kresolvsysctl(int, const int *);
 static void ktrsysret(struct ktr_sysret *, size_t);
+static void summarycall(struct ktr_header *, struct ktr_syscall *);
+static void summaryret(struct ktr_header *, struct ktr_sysret *);
+static int summarycmp(const void *, const void *);
+static void dumpsummary(void);
 static void ktruser(struct ktr_user *, size_t);
 static void ktrexec(const char*, size_t);
 static void ktrpledge(struct ktr_pledge *, size_t);
@@ -158,7 +182,7 @@ main(int argc, char *argv[])
 			screenwidth = 80;
 	}
 
-	while ((ch = getopt(argc, argv, "f:dHlm:np:RTt:xX")) != -1)
+	while ((ch = getopt(argc, argv, "f:dHlm:np:RSTt:xX")) != -1)
 		switch (ch) {
 		case 'f':
 			tracefile = optarg;
@@ -188,6 +212,9 @@ main(int argc, char *argv[])
 		case 'R':	/* relative timestamp */
 			timestamp = timestamp == 1 ? 3 : 2;
 			break;
+		case 'S':
+			summary = 1;
+			break;
 		case 'T':
 			timestamp = timestamp == 2 ? 3 : 1;
 			break;
@@ -228,7 +255,8 @@ main(int argc, char *argv[])
 		silent = 0;
 		if (pid_opt != -1 && pid_opt != ktr_header.ktr_pid)
 			silent = 1;
-		if (silent == 0 && trpoints & (1<<ktr_header.ktr_type))
+		if (silent == 0 && !summary &&
+		    trpoints & (1<<ktr_header.ktr_type))
 			dumpheader(&ktr_header);
 		ktrlen = ktr_header.ktr_len;
 		if (ktrlen > size) {
@@ -248,6 +276,15 @@ main(int argc, char *argv[])
 			continue;
 		if ((trpoints & (1<<ktr_header.ktr_type)) == 0)
 			continue;
+		if (summary) {
+			if (ktr_header.ktr_type == KTR_SYSCALL &&
+			    ktrlen >= sizeof(struct ktr_syscall))
+				summarycall(&ktr_header, m);
+			else if (ktr_header.ktr_type == KTR_SYSRET &&
+			    ktrlen >= sizeof(struct ktr_sysret))
+				summaryret(&ktr_header, m);
+			continue;
+		}
 		switch (ktr_header.ktr_type) {
 		case KTR_SYSCALL:
 			ktrsyscall(m, ktrlen);
@@ -284,6 +321,8 @@ main(int argc, char *argv[])
 		if (tail)
 			(void)fflush(stdout);
 	}
+	if (summary)
+		dumpsummary();
 	exit(0);
 }
 
@@ -1140,6 +1179,102 @@ doerr:
 	(void)putchar('\n');
 }
 
+static void
+summarycall(struct ktr_header *kth, struct ktr_syscall *ktr)
+{
+	struct sc_pending *p;
+
+	for (p = sc_pendings; p != NULL; p = p->next)
+		if (p->pid == kth->ktr_pid && p->tid == kth->ktr_tid)
+			break;
+	if (p == NULL) {
+		if ((p = malloc(sizeof(*p))) == NULL)
+			err(1, NULL);
+		p->pid = kth->ktr_pid;
+		p->tid = kth->ktr_tid;
+		p->next = sc_pendings;
+		sc_pendings = p;
+	}
+	p->code = ktr->ktr_code;
+	p->when = kth->ktr_time;
+	p->valid = 1;
+}
+
+static void
+summaryret(struct ktr_header *kth, struct ktr_sysret *ktr)
+{
+	struct sc_pending *p;
+	struct sc_stat *st;
+	struct timespec delta;
+
+	if (ktr->ktr_code < 0 || ktr->ktr_code >= SYS_MAXSYSCALL)
+		return;
+	st = &sc_stats[ktr->ktr_code];
+	st->calls++;
+	if (ktr->ktr_error != 0 && ktr->ktr_error != ERESTART &&
+	    ktr->ktr_error != EJUSTRETURN)
+		st->errors++;
+
+	/*
+	 * Time the syscall against the matching CALL record from the
+	 * same thread; the pairing can break across lost records or a
+	 * trace started mid-syscall, in which case just count it.
+	 */
+	for (p = sc_pendings; p != NULL; p = p->next)
+		if (p->pid == kth->ktr_pid && p->tid == kth->ktr_tid)
+			break;
+	if (p == NULL || !p->valid || p->code != ktr->ktr_code)
+		return;
+	p->valid = 0;
+	timespecsub(&kth->ktr_time, &p->when, &delta);
+	timespecadd(&st->total, &delta, &st->total);
+	if (timespeccmp(&delta, &st->max, >))
+		st->max = delta;
+}
+
+static int
+summarycmp(const void *a, const void *b)
+{
+	const struct sc_stat *sa = &sc_stats[*(const int *)a];
+	const struct sc_stat *sb = &sc_stats[*(const int *)b];
+
+	if (timespeccmp(&sa->total, &sb->total, <))
+		return (1);
+	if (timespeccmp(&sb->total, &sa->total, <))
+		return (-1);
+	if (sa->calls < sb->calls)
+		return (1);
+	if (sb->calls < sa->calls)
+		return (-1);
+	return (0);
+}
+
+static void
+dumpsummary(void)
+{
+	int codes[SYS_MAXSYSCALL];
+	struct sc_stat *st;
+	double total, max;
+	int i, n = 0;
+
+	for (i = 0; i < SYS_MAXSYSCALL; i++)
+		if (sc_stats[i].calls)
+			codes[n++] = i;
+	qsort(codes, n, sizeof(codes[0]), summarycmp);
+	printf("%-20s %10s %8s %12s %11s %11s\n", "syscall", "calls",
+	    "errors", "seconds", "avg-usec", "max-usec");
+	for (i = 0; i < n; i++) {
+		st = &sc_stats[codes[i]];
+		total = st->total.tv_sec + st->total.tv_nsec / 1e9;
+		max = st->max.tv_sec * 1e6 + st->max.tv_nsec / 1e3;
+		printf("%-20s %10llu %8llu %12.6f %11.1f %11.1f\n",
+		    syscallnames[codes[i]],
+		    (unsigned long long)st->calls,
+		    (unsigned long long)st->errors,
+		    total, total * 1e6 / st->calls, max);
+	}
+}
+
 static void
 ktrnamei(const char *cp, size_t len)
 {
@@ -1390,7 +1525,7 @@ usage(void)
 
 	extern char *__progname;
 	fprintf(stderr, "usage: %s "
-	    "[-dHlnRTXx] [-f file] [-m maxdata] [-p pid] [-t trstr]\n",
+	    "[-dHlnRSTXx] [-f file] [-m maxdata] [-p pid] [-t trstr]\n",
 	    __progname);
 	exit(1);
 }
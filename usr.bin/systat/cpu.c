@@ -146,16 +146,16 @@ percentages(int cnt, int64_t *out, int64_t *new, int64_t *old, int64_t *diffs)
 static void
 cpu_info(void)
 {
-	int	 cpustats_mib[] = { CTL_KERN, KERN_CPUSTATS, 0 }, i;
+	int	 cpustats_mib[] = { CTL_KERN, KERN_CPUSTATS,
+		    KERN_CPUSTATS_ALL }, i;
 	int64_t *tmpstate;
 	size_t	 size;
 
-	size = sizeof(*cpu_tm);
+	size = cpu_count * sizeof(*cpu_tm);
+	if (sysctl(cpustats_mib, 3, cpu_tm, &size, NULL, 0) == -1)
+		error("sysctl KERN_CPUSTATS");
 	for (i = 0; i < cpu_count; i++) {
-		cpustats_mib[2] = i;
 		tmpstate = cpu_states + (CPUSTATES * i);
-		if (sysctl(cpustats_mib, 3, &cpu_tm[i], &size, NULL, 0) == -1)
-			error("sysctl KERN_CPUSTATS");
 		percentages(CPUSTATES, tmpstate, cpu_tm[i].cs_time,
 		    cpu_old[i].cs_time, cpu_diff[i].cs_time);
 	}
@@ -600,14 +600,21 @@ putfloat(double f, int l, int c, int w, int d, int nz)
 static void
 getinfo(struct Info *si)
 {
-	static int cpustats_mib[3] = { CTL_KERN, KERN_CPUSTATS, 0 };
+	static int cpustats_mib[3] = { CTL_KERN, KERN_CPUSTATS,
+	    KERN_CPUSTATS_ALL };
 	static int nchstats_mib[2] = { CTL_KERN, KERN_NCHSTATS };
 	static int uvmexp_mib[2] = { CTL_VM, VM_UVMEXP };
 	static int vmtotal_mib[2] = { CTL_VM, VM_METER };
-	struct cpustats cs;
+	static struct cpustats *css;
 	int mib[4], i, j;
 	size_t size;
 
+	if (css == NULL) {
+		css = calloc(ncpu, sizeof(*css));
+		if (css == NULL)
+			errx(1, "out of memory");
+	}
+
 	dkreadstats();
 
 	for (i = 0; i < nintr; i++) {
@@ -622,17 +629,16 @@ getinfo(struct Info *si)
 	}
 
 	memset(&si->cpustats.cs_time, 0, sizeof(si->cpustats.cs_time));
+	size = ncpu * sizeof(*css);
+	if (sysctl(cpustats_mib, 3, css, &size, NULL, 0) == -1) {
+		error("Can't get KERN_CPUSTATS: %s\n", strerror(errno));
+		memset(css, 0, ncpu * sizeof(*css));
+	}
 	for (i = 0; i < ncpu; i++) {
-		cpustats_mib[2] = i;
-		size = sizeof(cs);
-		if (sysctl(cpustats_mib, 3, &cs, &size, NULL, 0) == -1) {
-			error("Can't get KERN_CPUSTATS: %s\n", strerror(errno));
-			memset(&si->cpustats, 0, sizeof(si->cpustats));
-		}
-		if ((cs.cs_flags & CPUSTATS_ONLINE) == 0)
+		if ((css[i].cs_flags & CPUSTATS_ONLINE) == 0)
 			continue;	/* omit totals for offline CPUs */
-		for (j = 0; j < nitems(cs.cs_time); j++)
-			si->cpustats.cs_time[j] += cs.cs_time[j];
+		for (j = 0; j < nitems(css[i].cs_time); j++)
+			si->cpustats.cs_time[j] += css[i].cs_time[j];
 	}
 
 	size = sizeof(si->nchstats);
@@ -256,7 +256,7 @@ format_header(char *second_field, int show_threads)
 void
 get_system_info(struct system_info *si)
 {
-	static int cpustats_mib[] = {CTL_KERN, KERN_CPUSTATS, /*fillme*/0};
+	static int cpustats_mib[] = {CTL_KERN, KERN_CPUSTATS, KERN_CPUSTATS_ALL};
 	static int sysload_mib[] = {CTL_VM, VM_LOADAVG};
 	static int uvmexp_mib[] = {CTL_VM, VM_UVMEXP};
 	static int bcstats_mib[] = {CTL_VFS, VFS_GENERIC, VFS_BCACHESTAT};
@@ -268,12 +268,11 @@ get_system_info(struct system_info *si)
 	int i;
 	int64_t *tmpstate;
 
-	size = sizeof(*cp_time);
+	size = ncpu * sizeof(*cp_time);
+	if (sysctl(cpustats_mib, 3, cp_time, &size, NULL, 0) == -1)
+		warn("sysctl kern.cpustats failed");
 	for (i = 0; i < ncpu; i++) {
-		cpustats_mib[2] = i;
 		tmpstate = cpu_states + (CPUSTATES * i);
-		if (sysctl(cpustats_mib, 3, &cp_time[i], &size, NULL, 0) == -1)
-			warn("sysctl kern.cpustats failed");
 		/* convert cpustats counts to percentages */
 		(void) percentages(CPUSTATES, tmpstate, cp_time[i].cs_time,
 		    cp_old[i].cs_time, cp_diff[i].cs_time);
@@ -35,6 +35,7 @@
 #include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <locale.h>
 #include <ctype.h>
 #include <err.h>
@@ -153,9 +154,10 @@ cnt(char *file)
 		if (doline) {
 			while ((len = read(fd, buf, MAXBSIZE)) > 0) {
 				charct += len;
-				for (C = buf; len--; ++C)
-					if (*C == '\n')
-						++linect;
+				/* memchr() scans a word at a time. */
+				for (C = buf; (C = memchr(C, '\n',
+				    len - (C - buf))) != NULL; ++C)
+					++linect;
 			}
 			if (len == -1) {
 				warn("%s", file);
@@ -68,6 +68,7 @@
 
 #include <sys/param.h>
 #include <sys/disklabel.h>
+#include <sys/stat.h>
 
 #include <assert.h>
 #include <errno.h>
@@ -409,7 +410,8 @@ static int
 ffs_create_image(const char *image, fsinfo_t *fsopts)
 {
 	struct fs	*fs;
-	char	*buf;
+	struct stat	 st;
+	char	*buf = NULL;
 	int	i, bufsize;
 	off_t	bufrem;
 	time_t	tstamp;
@@ -436,6 +438,20 @@ ffs_create_image(const char *image, fsinfo_t *fsopts)
 			return -1;
 		}
 
+	/*
+	 * A freshly truncated regular file reads back as zeros, so
+	 * extending it with ftruncate(2) gives the same result as the
+	 * zeroing loop while leaving untouched regions sparse.
+	 */
+	if (fsopts->offset == 0 && fstat(fsopts->fd, &st) == 0 &&
+	    S_ISREG(st.st_mode)) {
+		if (ftruncate(fsopts->fd, fsopts->size) == -1) {
+			warn("can't extend `%s'", image);
+			return (-1);
+		}
+		bufrem = 0;
+	}
+
 	if (bufrem > 0)
 		buf = ecalloc(1, bufsize);
 	while (bufrem > 0) {
@@ -45,9 +45,15 @@
 #include "lockd_lock.h"
 #include "lockd.h"
 
-/* A set of utilities for managing file locking */
+/*
+ * A set of utilities for managing file locking.
+ * Lock state is kept in a table hashed on the NFS filehandle, so that
+ * lookups stay cheap for clients holding many locks; operations keyed
+ * on something else (pid, host) walk all buckets.
+ */
 LIST_HEAD(lcklst_head, file_lock);
-struct lcklst_head lcklst_head = LIST_HEAD_INITIALIZER(lcklst_head);
+#define	LOCK_HASH_SIZE	128
+struct lcklst_head lock_hashtbl[LOCK_HASH_SIZE];
 
 #define	FHANDLE_SIZE_MAX	1024	/* arbitrary big enough value */
 typedef struct {
@@ -90,6 +96,19 @@ fhfree(nfs_fhandle_t *fh)
 	free(fh->fhdata);
 }
 
+static struct lcklst_head *
+lock_bucket(const nfs_fhandle_t *fh)
+{
+	const unsigned char *p = (const unsigned char *)fh->fhdata;
+	u_int32_t h = 0;
+	size_t i;
+
+	/* hash the same bytes fhcmp() compares */
+	for (i = 0; i < sizeof(fhandle_t); i++)
+		h = h * 31 + p[i];
+	return &lock_hashtbl[h % LOCK_HASH_SIZE];
+}
+
 /* struct describing a lock */
 struct file_lock {
 	LIST_ENTRY(file_lock) lcklst;
@@ -140,14 +159,15 @@ static struct file_lock *lock_lookup(struct file_lock *, int);
 
 /*
  * lock_lookup: lookup a matching lock.
- * called with siglock held.
+ * called with siglock held.  Only newfl's filehandle bucket is
+ * searched, so callers must always include LL_FH in flags.
  */
 static struct file_lock *
 lock_lookup(struct file_lock *newfl, int flags)
 {
 	struct file_lock *fl;
 
-	LIST_FOREACH(fl, &lcklst_head, lcklst) {
+	LIST_FOREACH(fl, lock_bucket(&newfl->filehandle), lcklst) {
 		if ((flags & LL_SVID) != 0 &&
 		    newfl->client.svid != fl->client.svid)
 			continue;
@@ -185,7 +205,7 @@ testlock(struct nlm4_lock *lock, int flags)
 
 	siglock();
 	/* search through the list for lock holder */
-	LIST_FOREACH(fl, &lcklst_head, lcklst) {
+	LIST_FOREACH(fl, lock_bucket(&filehandle), lcklst) {
 		if (fl->status != LKST_LOCKED)
 			continue;
 		if (fhcmp(&fl->filehandle, &filehandle) != 0)
@@ -317,7 +337,8 @@ getlock(nlm4_lockargs * lckarg, struct svc_req *rqstp, int flags)
 			    lckarg->alock.caller_name,
 			    lckarg->alock.svid);
 			newfl->status = LKST_WAITING;
-			LIST_INSERT_HEAD(&lcklst_head, newfl, lcklst);
+			LIST_INSERT_HEAD(lock_bucket(&newfl->filehandle),
+			    newfl, lcklst);
 			do_mon(lckarg->alock.caller_name);
 			sigunlock();
 			return (flags & LOCK_V4) ?
@@ -336,7 +357,7 @@ getlock(nlm4_lockargs * lckarg, struct svc_req *rqstp, int flags)
 	}
 
 	/* no entry for this file yet; add to list */
-	LIST_INSERT_HEAD(&lcklst_head, newfl, lcklst);
+	LIST_INSERT_HEAD(lock_bucket(&newfl->filehandle), newfl, lcklst);
 	/* do the lock */
 	retval = do_lock(newfl, lckarg->block);
 	switch (retval) {
@@ -367,7 +388,7 @@ unlock(nlm4_lock *lck, int flags)
 		return (flags & LOCK_V4) ? nlm4_denied : nlm_denied;
 	}
 	siglock();
-	LIST_FOREACH(fl, &lcklst_head, lcklst) {
+	LIST_FOREACH(fl, lock_bucket(&filehandle), lcklst) {
 		if (strcmp(fl->client_name, lck->caller_name) ||
 		    fhcmp(&filehandle, &fl->filehandle) != 0 ||
 		    fl->client.oh.n_len != lck->oh.n_len ||
@@ -433,7 +454,7 @@ void
 /*ARGSUSED*/
 sigchild_handler(int sig)
 {
-	int sstatus;
+	int sstatus, i;
 	pid_t pid;
 	struct file_lock *fl;
 
@@ -454,9 +475,12 @@ sigchild_handler(int sig)
 		 * if we're here we have a child that exited
 		 * Find the associated file_lock.
 		 */
-		LIST_FOREACH(fl, &lcklst_head, lcklst) {
-			if (pid == fl->locker)
-				break;
+		fl = NULL;
+		for (i = 0; i < LOCK_HASH_SIZE && fl == NULL; i++) {
+			LIST_FOREACH(fl, &lock_hashtbl[i], lcklst) {
+				if (pid == fl->locker)
+					break;
+			}
 		}
 		if (fl == NULL) {
 			syslog(LOG_NOTICE, "unknown child %d", pid);
@@ -705,7 +729,7 @@ do_unlock(struct file_lock *rfl)
 	LIST_REMOVE(rfl, lcklst);
 
 	/* process the next LKST_WAITING lock request for this fh */
-	LIST_FOREACH(fl, &lcklst_head, lcklst) {
+	LIST_FOREACH(fl, lock_bucket(&rfl->filehandle), lcklst) {
 		if (fl->status != LKST_WAITING ||
 		    fhcmp(&rfl->filehandle, &fl->filehandle) != 0)
 			continue;
@@ -807,11 +831,12 @@ void
 notify(const char *hostname, int state)
 {
 	struct file_lock *fl, *next_fl;
-	int err;
+	int err, i;
 	syslog(LOG_DEBUG, "notify from %s, new state %d", hostname, state);
 	/* search all lock for this host; if status changed, release the lock */
 	siglock();
-	for (fl = LIST_FIRST(&lcklst_head); fl != NULL; fl = next_fl) {
+	for (i = 0; i < LOCK_HASH_SIZE; i++)
+	    for (fl = LIST_FIRST(&lock_hashtbl[i]); fl != NULL; fl = next_fl) {
 		next_fl = LIST_NEXT(fl, lcklst);
 		if (strcmp(hostname, fl->client_name) == 0 &&
 		    fl->nsm_status != state) {
@@ -364,6 +364,20 @@ kr_iflastchange(void)
 int
 kr_updateif(u_int if_index)
 {
+	struct kif_node	*kn;
+
+	/*
+	 * Limit how often interface data is refetched from the kernel:
+	 * an NMS walking the interface tables otherwise triggers one
+	 * NET_RT_IFLIST sysctl per requested object.  Data fetched less
+	 * than a second ago is fresh enough for any polling cycle, and
+	 * routing socket messages update the tree on real changes
+	 * anyway.
+	 */
+	if ((kn = kif_find(if_index)) != NULL &&
+	    smi_getticks() - kn->k.if_ticks < 100)
+		return (0);
+
 	return (fetchifs(if_index));
 }
 
@@ -290,6 +290,10 @@ size_t	ctl_reply_offset = 0;	/* Number of bytes of reply written so far */
 char	*linebuf;
 int	 linesize;
 
+/* Datagrams read per event callback, see udp_readcb() and unix_readcb(). */
+#define RECV_BATCHSIZE	16
+char	*batchbuf;
+
 int		 fd_ctlconn, fd_udp, fd_udp6, send_udp, send_udp6;
 struct event	*ev_ctlaccept, *ev_ctlread, *ev_ctlwrite;
 
@@ -304,6 +308,7 @@ struct peer {
 char hostname_unknown[] = "???";
 
 void	 klog_readcb(int, short, void *);
+int	 recv_batch(int, struct mmsghdr *, struct iovec *, void *, socklen_t);
 void	 udp_readcb(int, short, void *);
 void	 unix_readcb(int, short, void *);
 int	 reserve_accept4(int, int, struct event *,
@@ -520,6 +525,8 @@ main(int argc, char *argv[])
 	linesize++;
 	if ((linebuf = malloc(linesize)) == NULL)
 		fatal("allocate line buffer");
+	if ((batchbuf = calloc(RECV_BATCHSIZE, LOG_MAXLINE + 1)) == NULL)
+		fatal("allocate batch buffer");
 
 	if (socket_bind("udp", NULL, "syslog", SecureMode,
 	    &fd_udp, &fd_udp6) == -1)
@@ -1045,42 +1052,77 @@ klog_readcb(int fd, short event, void *arg)
 	}
 }
 
-void
-udp_readcb(int fd, short event, void *arg)
+/*
+ * Drain up to RECV_BATCHSIZE datagrams per callback instead of taking
+ * an event loop round trip for each one; at high message rates the
+ * per-wakeup overhead is what makes syslogd fall behind and drop.
+ * MSG_WAITFORONE blocks for the first datagram only, matching the old
+ * one-recvfrom-per-callback behavior.
+ */
+int
+recv_batch(int fd, struct mmsghdr *mmsg, struct iovec *iov, void *sa,
+    socklen_t salen)
 {
-	struct sockaddr_storage	 sa;
-	socklen_t		 salen;
-	ssize_t			 n;
+	int	 i;
 
-	salen = sizeof(sa);
-	n = recvfrom(fd, linebuf, LOG_MAXLINE, 0, (struct sockaddr *)&sa,
-	    &salen);
-	if (n > 0) {
-		char	 resolve[NI_MAXHOST];
+	for (i = 0; i < RECV_BATCHSIZE; i++) {
+		iov[i].iov_base = batchbuf + i * (LOG_MAXLINE + 1);
+		iov[i].iov_len = LOG_MAXLINE;
+		memset(&mmsg[i], 0, sizeof(mmsg[i]));
+		mmsg[i].msg_hdr.msg_name = (char *)sa + i * salen;
+		mmsg[i].msg_hdr.msg_namelen = salen;
+		mmsg[i].msg_hdr.msg_iov = &iov[i];
+		mmsg[i].msg_hdr.msg_iovlen = 1;
+	}
 
-		linebuf[n] = '\0';
-		cvthname((struct sockaddr *)&sa, resolve, sizeof(resolve));
+	return (recvmmsg(fd, mmsg, RECV_BATCHSIZE, MSG_WAITFORONE, NULL));
+}
+
+void
+udp_readcb(int fd, short event, void *arg)
+{
+	struct mmsghdr		 mmsg[RECV_BATCHSIZE];
+	struct iovec		 iov[RECV_BATCHSIZE];
+	struct sockaddr_storage	 sa[RECV_BATCHSIZE];
+	char			 resolve[NI_MAXHOST];
+	char			*buf;
+	int			 i, n;
+
+	n = recv_batch(fd, mmsg, iov, sa, sizeof(sa[0]));
+	if (n == -1) {
+		if (errno != EINTR && errno != EWOULDBLOCK)
+			log_warn("recvmmsg udp");
+		return;
+	}
+	for (i = 0; i < n; i++) {
+		buf = iov[i].iov_base;
+		buf[mmsg[i].msg_len] = '\0';
+		cvthname((struct sockaddr *)&sa[i], resolve, sizeof(resolve));
 		log_debug("cvthname res: %s", resolve);
-		printline(resolve, linebuf);
-	} else if (n == -1 && errno != EINTR && errno != EWOULDBLOCK)
-		log_warn("recvfrom udp");
+		printline(resolve, buf);
+	}
 }
 
 void
 unix_readcb(int fd, short event, void *arg)
 {
-	struct sockaddr_un	 sa;
-	socklen_t		 salen;
-	ssize_t			 n;
-
-	salen = sizeof(sa);
-	n = recvfrom(fd, linebuf, LOG_MAXLINE, 0, (struct sockaddr *)&sa,
-	    &salen);
-	if (n > 0) {
-		linebuf[n] = '\0';
-		printline(LocalHostName, linebuf);
-	} else if (n == -1 && errno != EINTR && errno != EWOULDBLOCK)
-		log_warn("recvfrom unix");
+	struct mmsghdr		 mmsg[RECV_BATCHSIZE];
+	struct iovec		 iov[RECV_BATCHSIZE];
+	struct sockaddr_un	 sa[RECV_BATCHSIZE];
+	char			*buf;
+	int			 i, n;
+
+	n = recv_batch(fd, mmsg, iov, sa, sizeof(sa[0]));
+	if (n == -1) {
+		if (errno != EINTR && errno != EWOULDBLOCK)
+			log_warn("recvmmsg unix");
+		return;
+	}
+	for (i = 0; i < n; i++) {
+		buf = iov[i].iov_base;
+		buf[mmsg[i].msg_len] = '\0';
+		printline(LocalHostName, buf);
+	}
 }
 
 int
@@ -497,61 +497,44 @@ push_stack(uint32_t bootargsz, uint32_t end, uint32_t bootdev, uint32_t howto)
  * Return values:
  *  returns 'sz' if successful, or 0 otherwise.
  */
+#define MREAD_BUFSZ	(1024 * PAGE_SIZE)
+
 size_t
 mread(FILE *fp, paddr_t addr, size_t sz)
 {
-	size_t ct;
-	size_t i, rd, osz;
-	char buf[PAGE_SIZE];
+	size_t ct, osz;
+	char *buf;
 
 	/*
-	 * break up the 'sz' bytes into PAGE_SIZE chunks for use with
-	 * write_mem
+	 * write_mem copes with arbitrary addresses and lengths, so read
+	 * in large chunks instead of a page at a time; kernel and
+	 * ramdisk loading is a handful of fread/memcpy rounds this way.
 	 */
-	ct = 0;
-	rd = 0;
+	if ((buf = malloc(MREAD_BUFSZ)) == NULL) {
+		log_warn("%s: malloc error in mread", __progname);
+		return (0);
+	}
+
 	osz = sz;
-	if ((addr & PAGE_MASK) != 0) {
-		memset(buf, 0, sizeof(buf));
-		if (sz > PAGE_SIZE)
-			ct = PAGE_SIZE - (addr & PAGE_MASK);
-		else
-			ct = sz;
+	while (sz > 0) {
+		ct = sz > MREAD_BUFSZ ? MREAD_BUFSZ : sz;
 
 		if (fread(buf, 1, ct, fp) != ct) {
 			log_warn("%s: error %d in mread", __progname, errno);
+			free(buf);
 			return (0);
 		}
-		rd += ct;
-
-		if (write_mem(addr, buf, ct))
-			return (0);
-
-		addr += ct;
-	}
-
-	sz = sz - ct;
-
-	if (sz == 0)
-		return (osz);
-
-	for (i = 0; i < sz; i += PAGE_SIZE, addr += PAGE_SIZE) {
-		memset(buf, 0, sizeof(buf));
-		if (i + PAGE_SIZE > sz)
-			ct = sz - i;
-		else
-			ct = PAGE_SIZE;
 
-		if (fread(buf, 1, ct, fp) != ct) {
-			log_warn("%s: error %d in mread", __progname, errno);
+		if (write_mem(addr, buf, ct)) {
+			free(buf);
 			return (0);
 		}
-		rd += ct;
 
-		if (write_mem(addr, buf, ct))
-			return (0);
+		addr += ct;
+		sz -= ct;
 	}
 
+	free(buf);
 	return (osz);
 }
 
@@ -79,6 +79,8 @@ struct qcdisk {
 
 	int       fd;
 	uint64_t *l1;
+	uint64_t *l2cache;	/* last L2 table read, raw on-disk format */
+	off_t     l2cachetab;	/* disk offset of cached table, 0 if empty */
 	off_t     end;
 	off_t	  clustersz;
 	off_t	  disksz; /* In bytes */
@@ -261,6 +263,11 @@ qc2_open(struct qcdisk *disk, int *fds, size_t nfd)
 		fatalx("%s: unable to read qcow2 L1 table", __func__);
 	for (i = 0; i < disk->l1sz; i++)
 		disk->l1[i] = be64toh(disk->l1[i]);
+
+	disk->l2cache = malloc(disk->clustersz);
+	if (!disk->l2cache)
+		fatal("%s: could not allocate l2 cache", __func__);
+	disk->l2cachetab = 0;
 	version = be32toh(header.version);
 	if (version != 2 && version != 3)
 		fatalx("%s: unknown qcow2 version %d", __func__, version);
@@ -417,6 +424,7 @@ qc2_close(void *p, int stayopen)
 		qc2_close(disk->base, stayopen);
 	if (!stayopen)
 		close(disk->fd);
+	free(disk->l2cache);
 	free(disk->l1);
 	free(disk);
 }
@@ -432,7 +440,6 @@ static off_t
 xlate(struct qcdisk *disk, off_t off, int *inplace)
 {
 	off_t l2sz, l1off, l2tab, l2off, cluster, clusteroff;
-	uint64_t buf;
 
 
 	/*
@@ -443,7 +450,12 @@ xlate(struct qcdisk *disk, off_t off, int *inplace)
 	 */
 	if (inplace)
 		*inplace = 0;
-	pthread_rwlock_rdlock(&disk->lock);
+	/*
+	 * Exclusive because a miss below refills the shared L2 cache.
+	 * The critical section is short and cache hits skip the table
+	 * read entirely.
+	 */
+	pthread_rwlock_wrlock(&disk->lock);
 	if (off < 0)
 		goto err;
 
@@ -459,8 +471,15 @@ xlate(struct qcdisk *disk, off_t off, int *inplace)
 		return 0;
 	}
 	l2off = (off / disk->clustersz) % l2sz;
-	pread(disk->fd, &buf, sizeof(buf), l2tab + l2off * 8);
-	cluster = be64toh(buf);
+	if (disk->l2cachetab != l2tab) {
+		if (pread(disk->fd, disk->l2cache, disk->clustersz, l2tab) !=
+		    disk->clustersz) {
+			disk->l2cachetab = 0;
+			goto err;
+		}
+		disk->l2cachetab = l2tab;
+	}
+	cluster = be64toh(disk->l2cache[l2off]);
 	/*
 	 * cluster may be 0, but all future operations don't affect
 	 * the return value.
@@ -539,6 +558,8 @@ mkcluster(struct qcdisk *disk, struct qcdisk *base, off_t off, off_t src_phys)
 	buf = htobe64(cluster | QCOW2_INPLACE);
 	if (pwrite(disk->fd, &buf, sizeof(buf), l2tab + l2off * 8) != 8)
 		fatalx("%s: could not write cluster", __func__);
+	if (disk->l2cachetab == l2tab)
+		disk->l2cache[l2off] = buf;
 
 	/* TODO: lazily sync: currently VMD doesn't close things */
 	buf = htobe64(disk->l1[l1off]);